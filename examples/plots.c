@@ -2,51 +2,46 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <math.h>
 #include <pthread.h>
+#include <stdatomic.h>
 
 #define DATA_COUNT 4
+#define STREAM_WINDOW 200
 
-pthread_mutex_t data_mutex;
-int received_data_count = 0;
+atomic_bool feed_running = true;
 
 typedef struct
 {
-    GooeyPlotData *plot_data;
+    GooeyWindow *win;
     GooeyPlot *plot;
 } ThreadArgs;
 
-/*void* data_receiver_thread(void* arg) {
+void* data_receiver_thread(void* arg) {
     ThreadArgs* args = (ThreadArgs*)arg;
-    GooeyPlotData* data = args->plot_data;
+    float x = DATA_COUNT * 2;
 
-    float x_full[DATA_COUNT] = {-3, 4, 13.5, 14, 19};
-    float y_full[DATA_COUNT] = {-2, -3, 8, 13, 13};
+    while (atomic_load(&feed_running)) {
+        usleep(50000);
 
-    for (int i = 0; i < DATA_COUNT; i++) {
-        sleep(1);
+        // Samples can't be appended from this thread, they're posted and picked up by the window's next redraw.
+        float y = 10 * sinf(x / 4);
+        GooeyPlot_Post(args->plot, &x, &y, 1);
+        GooeyWindow_PostRedraw(args->win);
 
-        pthread_mutex_lock(&data_mutex);
-        data->x_data[i] = x_full[i];
-        data->y_data[i] = y_full[i];
-        received_data_count++;
-        pthread_mutex_unlock(&data_mutex);
-
-        printf("[Server] Received new data point: (%.2f, %.2f)\n", x_full[i], y_full[i]);
-
-        GooeyPlot_Update(args->plot, data);
+        printf("[Server] Received new data point: (%.2f, %.2f)\n", x, y);
+        x += 0.5f;
     }
 
     return NULL;
-}*/
+}
 
 int main()
 {
     Gooey_Init(GLFW);
     GooeyWindow win = GooeyWindow_Create("plot test", 800, 600, true);
 
-    pthread_mutex_init(&data_mutex, NULL);
-
-    GooeyPlotData data;
+    GooeyPlotData data = {0};
     char plot_title[] = "Dynamic Data Stream";
     data.title = plot_title;
     data.data_count = DATA_COUNT;
@@ -58,16 +53,17 @@ int main()
     data.x_data = x_partial;
     data.y_data = y_partial;
 
-    GooeyPlot *plot = GooeyPlot_Add(&win, GOOEY_PLOT_BAR, &data, 20, 20, 600, 400);
+    GooeyPlot *plot = GooeyPlot_Add(&win, GOOEY_PLOT_LINE, &data, 20, 20, 600, 400);
+    GooeyPlot_SetStreamWindow(plot, STREAM_WINDOW);
 
-    // pthread_t thread_id;
-    // ThreadArgs args = {&data, plot};
-    // thread_create(&thread_id, NULL, data_receiver_thread, &args);
+    pthread_t thread_id;
+    ThreadArgs args = {&win, plot};
+    pthread_create(&thread_id, NULL, data_receiver_thread, &args);
 
     GooeyWindow_Run(1, &win);
 
-    // pthread_join(thread_id, NULL);
-    // pthread_mutex_destroy(&data_mutex);
+    atomic_store(&feed_running, false);
+    pthread_join(thread_id, NULL);
     GooeyWindow_Cleanup(1, &win);
 
     return 0;
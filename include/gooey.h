@@ -28,6 +28,23 @@
  */
 int Gooey_Init(GooeyBackends backend);
 
+/**
+ * @brief Selects how window frames are paced.
+ *
+ * Defaults to GOOEY_FRAME_VSYNC at GOOEY_DEFAULT_REFRESH_RATE.
+ *
+ * @param mode GOOEY_FRAME_VSYNC, GOOEY_FRAME_UNCAPPED or GOOEY_FRAME_FIXED.
+ * @param target_fps Frame rate for GOOEY_FRAME_FIXED, display refresh rate for GOOEY_FRAME_VSYNC (<= 0 for the default).
+ */
+void Gooey_SetFrameMode(GOOEY_FRAME_MODE mode, int target_fps);
+
+/**
+ * @brief Wakes up the event loop if it is waiting for events.
+ *
+ * Safe to call from any thread.
+ */
+void Gooey_WakeUp(void);
+
 /**
  * @brief Sets the theme for the Gooey window.
  *
@@ -31,6 +31,17 @@ GooeyButton *GooeyButton_Add(GooeyWindow *win, const char *label, int x, int y,
  */
 bool GooeyButton_HandleClick(GooeyWindow *win, int x, int y);
 
+/**
+ * @brief Handles a click already resolved to a button by the window's hit index.
+ *
+ * Also releases the button previously pressed in the window.
+ *
+ * @param win The window containing the button.
+ * @param button The clicked button, NULL if the click landed on something else.
+ * @return True if a button was clicked, false otherwise.
+ */
+bool GooeyButton_HandleClickOn(GooeyWindow *win, GooeyButton *button);
+
 /**
  * @brief Sets the text of the button.
  *
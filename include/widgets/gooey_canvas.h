@@ -56,6 +56,33 @@ void GooeyCanvas_DrawLine(GooeyCanvas *canvas, int x1, int y1, int x2, int y2, u
  */
 void GooeyCanvas_DrawArc(GooeyCanvas *canvas, int x_center, int y_center, int width, int height, int angle1, int angle2);
 
+/**
+ * @brief Draws a line through a series of points onto the user-defined canvas.
+ *
+ * The whole path is drawn with a single backend call, which is much cheaper
+ * than drawing it one GooeyCanvas_DrawLine() segment at a time.
+ *
+ * @param canvas The user-defined canvas.
+ * @param xs The x-coordinates of the points.
+ * @param ys The y-coordinates of the points.
+ * @param count The number of points, at least 2.
+ * @param color_hex The color of the line in hexadecimal.
+ * @param width The width of the line in pixels.
+ */
+void GooeyCanvas_DrawPolyline(GooeyCanvas *canvas, const float *xs, const float *ys, size_t count, unsigned long color_hex, float width);
+
+/**
+ * @brief Draws a batch of square points onto the user-defined canvas.
+ *
+ * @param canvas The user-defined canvas.
+ * @param xs The x-coordinates of the points' centers.
+ * @param ys The y-coordinates of the points' centers.
+ * @param count The number of points.
+ * @param size The side of each point in pixels.
+ * @param color_hex The color of the points in hexadecimal.
+ */
+void GooeyCanvas_DrawPoints(GooeyCanvas *canvas, const float *xs, const float *ys, size_t count, float size, unsigned long color_hex);
+
 /**
  * @brief Sets foreground of the user-defined canvas.
  *
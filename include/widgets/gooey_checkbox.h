@@ -27,6 +27,14 @@ GooeyCheckbox *GooeyCheckbox_Add(GooeyWindow *win, int x, int y, char *label,
  */
 bool GooeyCheckbox_HandleClick(GooeyWindow *win, int x, int y);
 
+/**
+ * @brief Toggles a checkbox the window's hit index resolved a click to.
+ *
+ * @param checkbox The clicked checkbox.
+ * @return True, the click is always consumed.
+ */
+bool GooeyCheckbox_HandleClickOn(GooeyCheckbox *checkbox);
+
 
 void GooeyCheckbox_Draw(GooeyWindow *win);
 
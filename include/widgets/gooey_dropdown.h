@@ -31,6 +31,25 @@ GooeyDropdown *GooeyDropdown_Add(GooeyWindow *win, int x, int y, int width,
  * @return True if the dropdown menu was clicked, false otherwise.
  */
 bool GooeyDropdown_HandleClick(GooeyWindow *win, int x, int y);
+
+/**
+ * @brief Handles a click on the option list of an open dropdown.
+ *
+ * Open option lists float above the widgets below them, so this runs before
+ * the click is resolved through the window's hit index.
+ *
+ * @return True if an option was selected, false otherwise.
+ */
+bool GooeyDropdown_HandleOptionClick(GooeyWindow *win, int x, int y);
+
+/**
+ * @brief Opens or closes a dropdown the window's hit index resolved a click to.
+ *
+ * @param win The window containing the dropdown.
+ * @param dropdown The clicked dropdown.
+ * @return True, the click is always consumed.
+ */
+bool GooeyDropdown_HandleClickOn(GooeyWindow *win, GooeyDropdown *dropdown);
 /**
  * @brief Draws the drop down menu on the window.
  *
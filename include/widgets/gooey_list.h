@@ -25,9 +25,56 @@ GooeyList *GooeyList_Add(GooeyWindow *window, int x, int y, int width, int heigh
  */
 void GooeyList_AddItem(GooeyList *list, const char *title, const char *description);
 
+/**
+ * @brief Adds several items to a list widget at once.
+ *
+ * Storage for all of them is reserved up front, which makes loading large
+ * lists much cheaper than calling GooeyList_AddItem() in a loop.
+ *
+ * @param list The List widget you're adding the items to.
+ * @param titles The titles of the items.
+ * @param descriptions The descriptions of the items, NULL for none.
+ * @param count Number of items to add.
+ * @return true on success, false if the storage couldn't grow (no item is added then).
+ */
+bool GooeyList_AddItems(GooeyList *list, const char *const *titles, const char *const *descriptions, size_t count);
+
+/**
+ * @brief Switches a list widget to data provider mode.
+ *
+ * The list no longer stores its items, it asks `provider` for the rows it is
+ * about to draw and keeps the last GOOEY_LIST_CACHE_SIZE of them cached. Items
+ * previously added to the list are dropped. Call it again, even with the same
+ * provider, whenever the underlying data changes so stale rows are refetched.
+ *
+ * @param list The List widget.
+ * @param count Number of items the provider can serve.
+ * @param provider Called with the index of each row to fetch.
+ * @return true on success, false if the row cache couldn't be allocated.
+ */
+bool GooeyList_SetDataProvider(GooeyList *list, size_t count, GooeyListItemProvider provider);
+
+/**
+ * @brief Shows only the items whose title or description matches a query.
+ *
+ * Matching ignores ASCII case. Items added while a filter is set are matched
+ * as they come in, and the index passed to the list's callback is always the
+ * item's index in the unfiltered list. Extending the previous query only
+ * rechecks the items that matched it, so filtering as the user types stays
+ * cheap on large lists. Not available in data provider mode.
+ *
+ * @param list The List widget.
+ * @param query Text to look for, NULL or empty to show every item again.
+ * @param mode Whether the query may appear anywhere in the text or only at its start.
+ * @return true on success, false if the query is too long, the list uses a data provider or memory ran out.
+ */
+bool GooeyList_SetFilter(GooeyList *list, const char *query, GOOEY_LIST_FILTER_MODE mode);
+
 /**
  * @brief Clears all items from a list widget.
  *
+ * A list in data provider mode goes back to storing its own items.
+ *
  * @param list The List widget from which you're clearing all items.
  */
 void GooeyList_ClearItems(GooeyList *list);
@@ -60,6 +107,16 @@ bool GooeyList_HandleThumbScroll(GooeyWindow *window, GooeyEvent *scroll_event);
 
 bool GooeyList_HandleClick(GooeyWindow *window, int mouse_x, int mouse_y);
 
+/**
+ * @brief Handles a click the window's hit index resolved to a list, either on its thumb or on an item.
+ *
+ * @param list The list under the click.
+ * @param mouse_x The x-coordinate of the click event.
+ * @param mouse_y The y-coordinate of the click event.
+ * @return True if the click started a thumb drag or selected an item, false otherwise.
+ */
+bool GooeyList_HandleClickOn(GooeyList *list, int mouse_x, int mouse_y);
+
 /**
  * @brief Draws All attached list widgets onto window.
  *
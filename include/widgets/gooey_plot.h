@@ -37,6 +37,16 @@
   * @param win Pointer to the Gooey window where the plot will be drawn.
   */
  void GooeyPlot_Draw(GooeyWindow* win);
+
+ /**
+  * @brief Frees everything a plot allocated: streamed samples, aggregates,
+  * the cached layout and its GPU series and heatmap texture.
+  * 
+  * The plot's data isn't touched, it belongs to the caller.
+  * 
+  * @param plot Pointer to the GooeyPlot to release.
+  */
+ void GooeyPlot_Release(GooeyPlot *plot);
  
  /**
   * @brief Updates the data of an existing plot.
@@ -48,6 +58,210 @@
   * @param new_data Pointer to the new plot data.
   */
  void GooeyPlot_Update(GooeyPlot *plot, GooeyPlotData *new_data);
+
+ /**
+  * @brief Selects how a line plot thins out its samples before drawing.
+  * 
+  * When a line plot has more samples than its drawing area has pixel columns,
+  * only a representative subset is drawn, so drawing cost follows the plot's
+  * width instead of the sample count. The subset is recomputed only when the
+  * data, the plot's size or the mode changes. Defaults to GOOEY_PLOT_DECIMATION_M4.
+  * 
+  * @param plot Pointer to the GooeyPlot.
+  * @param mode GOOEY_PLOT_DECIMATION_M4 keeps every column's extremes so spikes
+  *        are never lost, GOOEY_PLOT_DECIMATION_LTTB draws fewer samples that
+  *        preserve the visual shape, GOOEY_PLOT_DECIMATION_NONE draws them all.
+  */
+ void GooeyPlot_SetDecimation(GooeyPlot *plot, GOOEY_PLOT_DECIMATION mode);
+
+ /**
+  * @brief Selects where a plot maps its samples to pixels.
+  * 
+  * With GOOEY_PLOT_RENDER_GPU, line and scatter plots upload their samples to
+  * a GPU buffer once and map them in the vertex shader, so changing the axis
+  * range or resizing the plot costs no per-sample work. Static data is
+  * uploaded again only after GooeyPlot_Update(), streamed data only uploads
+  * the samples appended since the last frame. Samples aren't decimated in
+  * this mode. Bar plots keep drawing on the CPU.
+  * 
+  * @param plot Pointer to the GooeyPlot.
+  * @param mode GOOEY_PLOT_RENDER_CPU (the default) or GOOEY_PLOT_RENDER_GPU.
+  * @return true on success, false if the active backend can't keep samples on the GPU.
+  */
+ bool GooeyPlot_SetRenderMode(GooeyPlot *plot, GOOEY_PLOT_RENDER mode);
+
+ /**
+  * @brief Sets the matrix shown by a GOOEY_PLOT_HEATMAP plot.
+  * 
+  * The values are copied and uploaded to the GPU as a single channel float
+  * texture, then mapped to colors through the plot's colormap in the
+  * fragment shader. Row 0 is drawn at the bottom. The axes count columns and
+  * rows, and the color range is set to the matrix' minimum and maximum.
+  * 
+  * @param plot Pointer to a heatmap GooeyPlot.
+  * @param values Row-major values, `rows` rows of `columns` values.
+  * @param columns Number of values per row.
+  * @param rows Number of rows.
+  * @return true on success, false if memory ran out or the active backend can't draw heatmaps.
+  */
+ bool GooeyPlot_SetHeatmap(GooeyPlot *plot, const float *values, size_t columns, size_t rows);
+
+ /**
+  * @brief Replaces some rows of a heatmap, only those rows are uploaded again.
+  * 
+  * @param plot Pointer to a heatmap GooeyPlot.
+  * @param first_row Index of the first replaced row, counted from the bottom.
+  * @param values Row-major values of the replaced rows.
+  * @param row_count Number of replaced rows.
+  * @return true on success, false if the rows lie outside the heatmap.
+  */
+ bool GooeyPlot_SetHeatmapRows(GooeyPlot *plot, size_t first_row, const float *values, size_t row_count);
+
+ /**
+  * @brief Scrolls a heatmap down by one row and shows `row` at the top.
+  * 
+  * The bottom row is dropped. Only the new row is uploaded, which keeps
+  * spectrogram-style heatmaps cheap to update every frame.
+  * 
+  * @param plot Pointer to a heatmap GooeyPlot.
+  * @param row The new row, as many values as the heatmap has columns.
+  * @return true on success, false if the plot has no matrix yet.
+  */
+ bool GooeyPlot_PushHeatmapRow(GooeyPlot *plot, const float *row);
+
+ /**
+  * @brief Sets the values mapped to the first and last colormap colors, values outside are clamped.
+  * 
+  * @param plot Pointer to a heatmap GooeyPlot.
+  * @param min_value Value shown with the first color.
+  * @param max_value Value shown with the last color.
+  */
+ void GooeyPlot_SetHeatmapRange(GooeyPlot *plot, float min_value, float max_value);
+
+ /**
+  * @brief Sets the colors a heatmap's values are mapped through, interpolated in between.
+  * 
+  * @param plot Pointer to a heatmap GooeyPlot.
+  * @param colors Evenly spaced colors in hexadecimal, from the minimum to the maximum value.
+  * @param count Number of colors, between 2 and GOOEY_PLOT_COLORMAP_MAX.
+  * @return true on success, false for an invalid colormap.
+  */
+ bool GooeyPlot_SetHeatmapColormap(GooeyPlot *plot, const unsigned long *colors, size_t count);
+
+ /**
+  * @brief Sets how finely a GOOEY_PLOT_HISTOGRAM or GOOEY_PLOT_DENSITY plot resolves its samples.
+  * 
+  * Both plot types take their raw samples from the data's `x_data` and work
+  * out the axis bounds themselves. Their bins or curve are computed again only
+  * when the data changes, so tens of millions of samples cost nothing to redraw.
+  * 
+  * @param plot Pointer to a histogram or density GooeyPlot.
+  * @param bin_count Number of histogram bins, or of points the density is
+  *        estimated at (at least 2). 0 restores GOOEY_PLOT_DEFAULT_HISTOGRAM_BINS
+  *        or GOOEY_PLOT_DEFAULT_DENSITY_POINTS.
+  */
+ void GooeyPlot_SetBinCount(GooeyPlot *plot, size_t bin_count);
+
+ /**
+  * @brief Sets the time range shown by a candlestick, OHLC or time series plot.
+  * 
+  * These plot types take ticks, times in seconds in `x_data` and prices in
+  * `y_data`, and aggregate them into buckets of 1 second up to 4 weeks. The
+  * view draws the buckets that span a few pixels each, so a decade of ticks
+  * redraws as fast as a day. Appended ticks are aggregated as they come in and
+  * all of them are kept, GooeyPlot_SetStreamWindow() doesn't apply. The price
+  * axis is fitted to the candles in view.
+  * 
+  * @param plot Pointer to a candlestick, OHLC or time series GooeyPlot.
+  * @param start Time at the left edge of the plot.
+  * @param end Time at the right edge of the plot. When not after `start`, the
+  *        plot goes back to showing every tick.
+  */
+ void GooeyPlot_SetTimeRange(GooeyPlot *plot, double start, double end);
+
+ /**
+  * @brief Sets how many of the latest appended samples a streaming plot keeps.
+  * 
+  * The plot keeps its samples in a ring buffer of `window_size` entries and
+  * older samples fall off as new ones are appended. Samples already in the
+  * plot are carried over, keeping the newest ones if they don't all fit.
+  * 
+  * @param plot Pointer to the GooeyPlot.
+  * @param window_size Number of samples to keep, must be at least 1.
+  * @return true on success, false if the window couldn't be allocated.
+  */
+ bool GooeyPlot_SetStreamWindow(GooeyPlot *plot, size_t window_size);
+
+ /**
+  * @brief Appends a sample to a plot, dropping the oldest one when the window is full.
+  * 
+  * The first append turns the plot into a streaming plot with a window of
+  * GOOEY_PLOT_DEFAULT_STREAM_WINDOW samples unless GooeyPlot_SetStreamWindow()
+  * was called. The plot's data then points into the window, and its bounds
+  * are kept up to date in amortized constant time. Samples must come in
+  * non-decreasing x order. Call it from the thread running the window, other
+  * threads hand samples over with GooeyPlot_Post().
+  * 
+  * @param plot Pointer to the GooeyPlot.
+  * @param x X value of the sample.
+  * @param y Y value of the sample.
+  * @return true on success, false if x goes backwards or memory ran out.
+  */
+ bool GooeyPlot_Append(GooeyPlot *plot, float x, float y);
+
+ /**
+  * @brief Appends several samples to a plot at once, see GooeyPlot_Append().
+  * 
+  * @param plot Pointer to the GooeyPlot.
+  * @param x X values of the samples, in non-decreasing order.
+  * @param y Y values of the samples.
+  * @param count Number of samples.
+  * @return true on success, false if the x values go backwards (no sample is appended then) or memory ran out.
+  */
+ bool GooeyPlot_AppendBatch(GooeyPlot *plot, const float *x, const float *y, size_t count);
+
+ /**
+  * @brief Hands samples to a plot from any thread, e.g. a thread reading a live feed.
+  * 
+  * The samples are copied under the plot's lock and appended with
+  * GooeyPlot_AppendBatch() on the window's thread at the start of its next
+  * redraw. Follow it with GooeyWindow_PostRedraw() so the window wakes up and
+  * shows them.
+  * 
+  * @param plot Pointer to the GooeyPlot.
+  * @param x X values of the samples, in non-decreasing order.
+  * @param y Y values of the samples.
+  * @param count Number of samples.
+  * @return true on success, false if memory ran out.
+  */
+ bool GooeyPlot_Post(GooeyPlot *plot, const float *x, const float *y, size_t count);
+
+ /**
+  * @brief Appends the samples posted to the window's plots since its last redraw.
+  * 
+  * Called by the window before it works out what to repaint, so the plots
+  * the samples change are part of the frame.
+  * 
+  * @param win Pointer to the Gooey window.
+  */
+ void GooeyPlot_DrainPosted(GooeyWindow *win);
+
+ /**
+  * @brief Appends ticks to a candlestick, OHLC or time series plot.
+  * 
+  * Times are doubles so epoch times keep their seconds, a float only holds
+  * every 128th second of them. Each tick only updates the last bucket of
+  * every aggregation level, and the ticks are kept across GooeyPlot_Update()
+  * calls with the plot's own data. GooeyPlot_AppendBatch() on these plots
+  * appends through here.
+  * 
+  * @param plot Pointer to a candlestick, OHLC or time series GooeyPlot.
+  * @param times Time of each tick in seconds, in non-decreasing order.
+  * @param prices Price of each tick.
+  * @param count Number of ticks.
+  * @return true on success, false if the times go backwards (no tick is appended then) or memory ran out.
+  */
+ bool GooeyPlot_AppendTicks(GooeyPlot *plot, const double *times, const float *prices, size_t count);
  
  #endif /* GOOEY_PLOT_H */
  
\ No newline at end of file
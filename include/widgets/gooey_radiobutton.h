@@ -30,6 +30,17 @@ bool GooeyRadioButton_HandleClick(GooeyWindow *win, int x, int y);
 
 bool GooeyRadioButtonGroup_HandleClick(GooeyWindow *win, int x, int y);
 
+/**
+ * @brief Handles a click the window's hit index resolved to a radio button, grouped or standalone.
+ *
+ * @param win The window containing the radio button.
+ * @param button The radio button under the click.
+ * @param x The x-coordinate of the click event.
+ * @param y The y-coordinate of the click event.
+ * @return True if the click landed inside the button's circle, false otherwise.
+ */
+bool GooeyRadioButton_HandleClickOn(GooeyWindow *win, GooeyRadioButton *button, int x, int y);
+
 
 /**
  * @brief Creates a radio button group widget.
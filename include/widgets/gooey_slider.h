@@ -29,6 +29,16 @@ GooeySlider *GooeySlider_Add(GooeyWindow *win, int x, int y, int width,
  * @return True if the slider was dragged, false otherwise.
  */
 bool GooeySlider_HandleDrag(GooeyWindow *win, GooeyEvent *event);
+
+/**
+ * @brief Starts dragging a slider the window's hit index resolved a click to.
+ *
+ * @param slider The clicked slider.
+ * @param x The x-coordinate of the click event.
+ * @return True, the click is always consumed.
+ */
+bool GooeySlider_HandleClickOn(GooeySlider *slider, int x);
+
 /**
  * @brief Gets the current value of the slider.
  *
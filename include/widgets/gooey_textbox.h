@@ -36,13 +36,23 @@ void GooeyTextbox_Draw(GooeyWindow *win);
  */
 bool GooeyTextbox_HandleClick(GooeyWindow *win, int x, int y);
 
+/**
+ * @brief Focuses a textbox the window's hit index resolved a click to, unfocusing the others.
+ *
+ * @param win The window containing the textbox.
+ * @param textbox The clicked textbox.
+ * @return True, the click is always consumed.
+ */
+bool GooeyTextbox_HandleClickOn(GooeyWindow *win, GooeyTextbox *textbox);
+
 /**
  * @brief Handles key press events for the textbox.
  *
  * @param win The window containing the textbox.
  * @param key_event The key event to handle.
+ * @return True if a focused textbox took the key, false otherwise.
  */
-void GooeyTextbox_HandleKeyPress(GooeyWindow *win, GooeyEvent *event);
+bool GooeyTextbox_HandleKeyPress(GooeyWindow *win, GooeyEvent *event);
 
 /**
  * @brief Gets the text of the textbox.
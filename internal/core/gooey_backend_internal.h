@@ -1,6 +1,7 @@
 #ifndef GOOEY_BACKEND_INTERNAL_H
 #define GOOEY_BACKEND_INTERNAL_H
 #include "core/gooey_common.h"
+#include "gooey_types_internal.h"
 
 typedef enum GooeyBackends
 {
@@ -29,6 +30,7 @@ typedef struct GooeyBackend
     void (*SetContext)(GooeyWindow *win);
     void (*UpdateBackground)(void);
     void (*Clear)(int window_id);
+    void (*SetClipRect)(int window_id, int x, int y, int width, int height); /**< Optional, clips Clear and drawing until Render, a zero sized rect disables clipping. */
     void (*Render)(int window_id);
     void (*SetForeground)(unsigned long color);
     void (*DrawText)(int x, int y, const char *text, unsigned long color, float font_size, int window_id);
@@ -36,13 +38,28 @@ typedef struct GooeyBackend
     void (*DrawRectangle)(int x, int y, int width, int height, unsigned long color, int window_id);
     void (*FillArc)(int x, int y, int width, int height, int angle1, int angle2, int window_id);
     const char *(*GetKeyFromCode)(GooeyEvent *gooey_event);
-    GooeyEvent *(*HandleEvents)(void);
-    void (*InhibitResetEvents)(bool state);
+    void (*HandleEvents)(void);                 /**< Queues the events the window system has pending, without blocking. */
+    void (*WaitEvents)(double timeout);         /**< Optional, like HandleEvents but blocks up to `timeout` seconds (forever if negative). */
+    void (*WakeUp)(void);                       /**< Optional, interrupts WaitEvents. Must be safe to call from any thread. */
+    bool (*PopEvent)(GooeyEvent *event);        /**< Takes the oldest queued event, false once the queue is empty. */
     void (*GetWinDim)(int *width, int *height, int window_id);
     void (*DrawLine)(int x1, int y1, int x2, int y2, unsigned long color, int window_id);
+    void (*DrawPolyline)(const float *xs, const float *ys, size_t count, unsigned long color, float width, int window_id); /**< Connects `count` points with one call. */
+    void (*DrawPoints)(const float *xs, const float *ys, size_t count, float size, unsigned long color, int window_id);   /**< Draws `count` square points of `size` pixels with one call. */
+    void (*DrawMarkers)(const float *xs, const float *ys, size_t count, const float *sizes, const unsigned char *colors, float size, unsigned long color, int window_id); /**< Draws `count` round markers with one instanced call, `sizes` (diameters) and `colors` (RGBA bytes) may be NULL to use `size` and `color` for all. */
+    int (*CreateSeries)(void);                                                                                                    /**< Optional, allocates a GPU buffer for plot samples, returns its handle or -1. */
+    bool (*UploadSeries)(int series, const float *xs, const float *ys, size_t offset, size_t count, size_t capacity, int window_id); /**< Writes samples [offset, offset + count) of a series holding `capacity` samples, a new capacity drops the previous content. */
+    void (*DrawSeries)(int series, size_t first, size_t count, const GooeyPlotTransform *transform, float point_size, unsigned long color, int window_id); /**< Maps samples to pixels in the vertex shader, draws a line strip if `point_size` is 0 and points otherwise. */
+    void (*DestroySeries)(int series);
+    int (*CreateHeatmap)(void);                                                                                                   /**< Optional, allocates a float texture drawn through a colormap, returns its handle or -1. */
+    bool (*UploadHeatmapRows)(int heatmap, const float *values, size_t columns, size_t rows, size_t first_row, size_t row_count, int window_id); /**< Writes `row_count` rows of a `columns` x `rows` heatmap, a new size drops the previous content. */
+    bool (*UploadHeatmapColormap)(int heatmap, const unsigned long *colors, size_t count, int window_id);                        /**< Sets the colors values are mapped to, from the minimum to the maximum. */
+    void (*DrawHeatmap)(int heatmap, float x, float y, float width, float height, size_t first_row, float min_value, float max_value, int window_id); /**< Stretches the heatmap over a rectangle, `first_row` at the bottom and the rows above it wrapping around. */
+    void (*DestroyHeatmap)(int heatmap);
     float (*GetTextWidth)(const char *text, int length);
     float (*GetTextHeight)(const char *text, int length);
     void (*SetCursor)(GOOEY_CURSOR cursor);
+    void (*SetSwapInterval)(int interval); /**< Optional, 1 waits for vblank on swap, 0 doesn't. */
 } GooeyBackend;
 
 /**
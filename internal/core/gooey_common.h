@@ -7,6 +7,8 @@
 #include <ctype.h>
 
 #include "gooey_widgets_internal.h"
+#include "core/gooey_frame_scheduler.h"
+#include "core/gooey_spatial_index.h"
 #include "utils/theme/gooey_theme_internal.h"
 #include "gooey_event_internal.h"
 #include "utils/logger/gooey_logger_internal.h"
@@ -42,6 +44,7 @@ typedef struct
     GooeyCanvas *canvas;                        /**< List of canvas widgets in the window. */
     GooeyPlot *plots;                            /**< List of all plot widgets. */
     GooeyWidget **widgets;                      /**< List containing unified definition of every widget. */
+    GooeySpatialIndex hit_index;                /**< Click areas of the interactive widgets, keyed by registry index. */
 
     size_t list_count;
     size_t scrollable_count;         /**< Number of scrollables in the window */
@@ -57,6 +60,15 @@ typedef struct
     size_t canvas_count;             /**< Number of all canvas widgets in the window */
     size_t plot_count;               /**< Number of all plot widgets. */
     size_t widget_count;             /**< Total number of registered widgets in the window. */
+    size_t widget_capacity;          /**< Allocated slots in the widget registry. */
+
+    GooeyRect damage;                /**< Region being repainted by the current redraw. */
+    bool needs_full_redraw;          /**< Forces the next redraw to repaint the whole window. */
+    unsigned int theme_generation;   /**< Theme generation the window was last painted with. */
+    GooeyFrameState frame;           /**< Pending redraw and frame pacing statistics. */
+    unsigned int geometry_generation; /**< Widget geometry generation the hit index was last synced with. */
+    GOOEY_CURSOR current_cursor;     /**< Cursor shape last set while the pointer was over the window. */
+    int pressed_button;              /**< Index of the button shown pressed, -1 when none. */
 
 } GooeyWindow;
 
@@ -114,6 +126,38 @@ void GooeyWindow_Run(int num_windows, GooeyWindow *first_win, ...);
  */
 void GooeyWindow_Cleanup(int num_windows, GooeyWindow *first_win, ...);
 void GooeyWindow_RegisterWidget(GooeyWindow *win, GooeyWidget *widget);
+
+/**
+ * @brief Finds the topmost interactive widget whose click area contains the point.
+ *
+ * Uses the window's hit index, so the cost doesn't depend on the number of
+ * widgets. Widgets registered later are on top of earlier ones.
+ *
+ * @param win The window to search.
+ * @param x The x-coordinate in window space.
+ * @param y The y-coordinate in window space.
+ * @return The widget, or NULL if the point isn't over an interactive widget.
+ */
+GooeyWidget *GooeyWindow_WidgetAt(GooeyWindow *win, int x, int y);
+
+/**
+ * @brief Picks the cursor shape for the pointer position.
+ *
+ * @param win The window under the pointer.
+ * @param cursor Receives the shape if the pointer is over an interactive widget.
+ * @param x The x-coordinate of the pointer.
+ * @param y The y-coordinate of the pointer.
+ * @return true if the pointer is over an interactive widget.
+ */
+bool GooeyWindow_HandleCursorChange(GooeyWindow *win, GOOEY_CURSOR *cursor, int x, int y);
+
+/**
+ * @brief Tells the windows a widget's position or size changed, so its click area gets reindexed
+ * and the area it moved from and to gets repainted.
+ *
+ * @param widget The widget that moved or was resized.
+ */
+void GooeyWidget_MarkMoved(GooeyWidget *widget);
 /**
  * @brief Sets the resizable property of a window.
  *
@@ -124,8 +168,72 @@ void GooeyWindow_RegisterWidget(GooeyWindow *win, GooeyWidget *widget);
  */
 void GooeyWindow_MakeResizable(GooeyWindow *msgBoxWindow, bool is_resizable);
 
+/**
+ * @brief Draws a frame of the window right away.
+ *
+ * Prefer GooeyWindow_RequestRedraw(), which lets the frame scheduler merge
+ * requests and pace frames.
+ *
+ * @param win The window to draw.
+ */
 void GooeyWindow_Redraw(GooeyWindow *win);
 
+/**
+ * @brief Schedules a frame of the window.
+ *
+ * Requests made before the frame is drawn are merged, so a window draws at
+ * most one frame per interval of the current frame mode.
+ *
+ * @param win The window to redraw.
+ */
+void GooeyWindow_RequestRedraw(GooeyWindow *win);
+
+/**
+ * @brief Number of frames of the window that were presented later than one frame interval after they were due.
+ *
+ * @param win The window to query.
+ * @return The missed deadline count.
+ */
+unsigned long GooeyWindow_GetMissedFrames(GooeyWindow *win);
+
+/**
+ * @brief Schedules a frame of the window from any thread.
+ *
+ * Use it from background work that changed what the window shows. The event
+ * loop is woken up and schedules the frame on the UI thread.
+ *
+ * @param win The window to redraw.
+ */
+void GooeyWindow_PostRedraw(GooeyWindow *win);
+
+/**
+ * @brief Flags a widget for repainting on the next redraw of its window.
+ *
+ * @param widget The widget whose appearance changed.
+ */
+void GooeyWidget_MarkDirty(GooeyWidget *widget);
+
+/**
+ * @brief Makes the next redraw repaint the whole window instead of the dirty widgets only.
+ *
+ * Needed when something that isn't a registered widget changes, like an open
+ * dropdown or menu covering its neighbours. Also schedules the redraw.
+ *
+ * @param win The window to repaint.
+ */
+void GooeyWindow_RequestFullRedraw(GooeyWindow *win);
+
+/**
+ * @brief Checks whether a widget overlaps the region repainted by the current redraw.
+ *
+ * Draw functions use it to skip widgets left untouched by a partial redraw.
+ *
+ * @param win The window being redrawn.
+ * @param widget The widget to test.
+ * @return true if the widget has to be drawn.
+ */
+bool GooeyWindow_IsDamaged(GooeyWindow *win, GooeyWidget *widget);
+
 extern GooeyTheme *active_theme;
 
 #endif
\ No newline at end of file
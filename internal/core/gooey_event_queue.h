@@ -0,0 +1,61 @@
+/*
+ Copyright (c) 2024 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef GOOEY_EVENT_QUEUE_H
+#define GOOEY_EVENT_QUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "gooey_event_internal.h"
+
+/** Number of events a queue holds before new ones are dropped. */
+#define GOOEY_EVENT_QUEUE_CAPACITY 512
+
+/**
+ * @brief Fixed capacity FIFO of window events.
+ *
+ * Backends push from their window system callbacks and the run loop drains
+ * it after each poll, so every event delivered by one poll is seen, in order.
+ */
+typedef struct
+{
+    GooeyEvent events[GOOEY_EVENT_QUEUE_CAPACITY];
+    size_t head;           /**< Index of the oldest queued event. */
+    size_t count;          /**< Number of queued events. */
+    unsigned long dropped; /**< Events rejected because the queue was full. */
+} GooeyEventQueue;
+
+void GooeyEventQueue_Init(GooeyEventQueue *queue);
+
+/**
+ * @brief Stamps the event with the current monotonic time and appends it.
+ *
+ * A mouse move directly following another mouse move of the same window
+ * replaces it instead of taking a new slot, only the latest position matters.
+ *
+ * @return false if the queue was full and the event was dropped.
+ */
+bool GooeyEventQueue_Push(GooeyEventQueue *queue, const GooeyEvent *event);
+
+/**
+ * @brief Removes the oldest event and copies it into `event`.
+ *
+ * @return false if the queue was empty.
+ */
+bool GooeyEventQueue_Pop(GooeyEventQueue *queue, GooeyEvent *event);
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ Copyright (c) 2024 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef GOOEY_FRAME_SCHEDULER_H
+#define GOOEY_FRAME_SCHEDULER_H
+
+#include <stdbool.h>
+#include <stdatomic.h>
+
+/** Refresh rate assumed for vsync pacing when none is given. */
+#define GOOEY_DEFAULT_REFRESH_RATE 60
+
+/**
+ * @brief How frames are paced.
+ */
+typedef enum
+{
+    GOOEY_FRAME_VSYNC,    /**< At most one frame per display refresh, swaps wait for vblank. */
+    GOOEY_FRAME_UNCAPPED, /**< Draw as soon as a redraw is requested, swaps don't wait for vblank. */
+    GOOEY_FRAME_FIXED     /**< At most `target_fps` frames per second, swaps don't wait for vblank. */
+} GOOEY_FRAME_MODE;
+
+/**
+ * @brief Per-window pacing state.
+ *
+ * Redraw requests only set `pending`, so any number of requests made while
+ * handling a batch of events collapse into a single frame.
+ */
+typedef struct
+{
+    bool pending;                   /**< A redraw was requested since the last frame. */
+    double requested_at;            /**< When the oldest pending request was made, in seconds. */
+    double last_presented_at;       /**< When the last frame was presented, in seconds. */
+    unsigned long frame_count;      /**< Frames presented so far. */
+    unsigned long missed_deadlines; /**< Frames presented more than one interval after they were due. */
+    atomic_bool posted;             /**< Set by GooeyFrameScheduler_Post() from any thread. */
+} GooeyFrameState;
+
+/**
+ * @brief Monotonic time in seconds.
+ */
+double GooeyFrameScheduler_Now(void);
+
+/**
+ * @brief Selects the pacing mode shared by every window.
+ *
+ * @param mode The pacing mode.
+ * @param target_fps Frame rate for GOOEY_FRAME_FIXED, or the display refresh
+ *        rate for GOOEY_FRAME_VSYNC (GOOEY_DEFAULT_REFRESH_RATE when <= 0).
+ *        Ignored by GOOEY_FRAME_UNCAPPED.
+ */
+void GooeyFrameScheduler_SetMode(GOOEY_FRAME_MODE mode, int target_fps);
+
+GOOEY_FRAME_MODE GooeyFrameScheduler_GetMode(void);
+
+/**
+ * @brief Minimum time between two frames of a window in the current mode, 0 when uncapped.
+ */
+double GooeyFrameScheduler_GetInterval(void);
+
+/**
+ * @brief Records a redraw request, folding it into the one already pending if any.
+ */
+void GooeyFrameScheduler_Request(GooeyFrameState *state);
+
+/**
+ * @brief Records a redraw request from any thread.
+ *
+ * The request only becomes pending once the UI thread calls
+ * GooeyFrameScheduler_CollectPosted().
+ */
+void GooeyFrameScheduler_Post(GooeyFrameState *state);
+
+/**
+ * @brief Turns a request posted from another thread into a pending frame. UI thread only.
+ */
+void GooeyFrameScheduler_CollectPosted(GooeyFrameState *state);
+
+/**
+ * @brief Sleeps for the given number of seconds, used when the backend can't block on its event queue.
+ */
+void GooeyFrameScheduler_Sleep(double seconds);
+
+/**
+ * @brief Seconds left before a pending frame may be drawn.
+ *
+ * @return 0 if the frame is due now, a negative value if nothing is pending.
+ */
+double GooeyFrameScheduler_TimeUntilDue(const GooeyFrameState *state, double now);
+
+/**
+ * @brief Tells the scheduler a frame was presented, clearing the pending request.
+ *
+ * @param state The window's pacing state.
+ * @param presented_at When the frame reached the screen.
+ */
+void GooeyFrameScheduler_FramePresented(GooeyFrameState *state, double presented_at);
+
+#endif
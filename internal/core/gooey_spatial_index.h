@@ -0,0 +1,86 @@
+/*
+ Copyright (c) 2024 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef GOOEY_SPATIAL_INDEX_H
+#define GOOEY_SPATIAL_INDEX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "gooey_widgets_internal.h"
+
+/** Side of a grid cell in pixels. */
+#define GOOEY_SPATIAL_CELL_SIZE 64
+
+/**
+ * @brief Ids of the entries overlapping one grid cell, in increasing order.
+ */
+typedef struct
+{
+    size_t *ids;
+    size_t count;
+    size_t capacity;
+} GooeySpatialCell;
+
+/**
+ * @brief Bounds an entry was indexed with.
+ */
+typedef struct
+{
+    GooeyRect bounds;
+    bool indexed; /**< false for ids that were never set or were removed. */
+} GooeySpatialEntry;
+
+/**
+ * @brief Uniform grid over window coordinates, answering "what is under this point" without visiting every entry.
+ *
+ * Entries are identified by a caller chosen id, a higher id is considered on
+ * top of a lower one. The grid starts at the window origin and grows to the
+ * right and bottom as entries need it; coordinates left of or above the
+ * origin fall in the first column or row.
+ */
+typedef struct
+{
+    GooeySpatialCell *cells; /**< `columns * rows` cells, row major. */
+    int columns;
+    int rows;
+    GooeySpatialEntry *entries; /**< Indexed bounds of each id. */
+    size_t entry_capacity;
+} GooeySpatialIndex;
+
+void GooeySpatialIndex_Init(GooeySpatialIndex *index);
+
+/**
+ * @brief Inserts the entry, or moves it if it was already indexed.
+ *
+ * Only the cells the entry leaves or enters are touched. An empty rect
+ * removes the entry.
+ *
+ * @return false if memory ran out, the entry is then left out of the index.
+ */
+bool GooeySpatialIndex_Set(GooeySpatialIndex *index, size_t id, GooeyRect bounds);
+
+/**
+ * @brief Finds the topmost entry whose bounds contain the point, edges included.
+ *
+ * @param id Receives the entry's id.
+ * @return false if no entry contains the point.
+ */
+bool GooeySpatialIndex_QueryTopmost(const GooeySpatialIndex *index, int x, int y, size_t *id);
+
+void GooeySpatialIndex_Free(GooeySpatialIndex *index);
+
+#endif
@@ -48,6 +48,7 @@ typedef struct
 {
     GooeyEventType type;
     int attached_window;
+    double timestamp; /**< Monotonic time the event was queued at, in seconds. */
 
     GooeyMouseData click;
     GooeyMouseData mouse_move;
@@ -0,0 +1,43 @@
+/*
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file gooey_types_internal.h
+ * @brief Plain types shared by the widgets, the backends and the utilities.
+ */
+
+#ifndef GOOEY_TYPES_INTERNAL_H
+#define GOOEY_TYPES_INTERNAL_H
+
+/**
+ * @brief Affine mapping from data space to pixel space, and the pixel rectangle points are clipped against.
+ *
+ * A point (x, y) maps to (x * scale_x + offset_x, y * scale_y + offset_y).
+ */
+typedef struct
+{
+    float scale_x;
+    float offset_x;
+    float scale_y;
+    float offset_y;
+    float clip_left;
+    float clip_right;
+    float clip_top;
+    float clip_bottom;
+} GooeyPlotTransform;
+
+#endif /* GOOEY_TYPES_INTERNAL_H */
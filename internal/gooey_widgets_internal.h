@@ -20,6 +20,9 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <pthread.h>
+#include "gooey_types_internal.h"
+#include "utils/plot/gooey_plot_pyramid_internal.h"
 
 /** Maximum number of widgets that can be added to a window. */
 #define MAX_WIDGETS 100
@@ -36,6 +39,9 @@
 /** Height of the slider widget. */
 #define SLIDER_HEIGHT 5
 
+/** Distance above and below a slider track that still grabs the slider. */
+#define SLIDER_GRAB_MARGIN 20
+
 /** Maximum number of menu children. */
 #define MAX_MENU_CHILDREN 10
 
@@ -45,6 +51,18 @@
 /**< Maxiumum number of plots. */
 #define MAX_PLOT_COUNT 100
 
+/** Samples kept by a streaming plot whose window size was never set. */
+#define GOOEY_PLOT_DEFAULT_STREAM_WINDOW 4096
+
+/** Maximum number of colors in a heatmap colormap. */
+#define GOOEY_PLOT_COLORMAP_MAX 256
+
+/** Bins of a histogram plot whose bin count was never set. */
+#define GOOEY_PLOT_DEFAULT_HISTOGRAM_BINS 64
+
+/** Grid points a density plot is estimated at when its bin count was never set. */
+#define GOOEY_PLOT_DEFAULT_DENSITY_POINTS 512
+
 
 /**
  * @brief Enumeration for widget types in the Gooey framework.
@@ -60,17 +78,31 @@ typedef enum
   WIDGET_DROPDOWN,    /**< Dropdown widget */
   WIDGET_CANVAS,      /**< Canvas widget */
   WIDGET_LAYOUT,
-  WIDGET_PLOT
+  WIDGET_PLOT,
+  WIDGET_LIST         /**< List widget */
 } WIDGET_TYPE;
 
+/**
+ * @brief An axis aligned rectangle in window coordinates.
+ */
+typedef struct
+{
+  int x, y;
+  int width, height;
+} GooeyRect;
+
 /**
  * @brief A base structure for all Gooey widgets containing their position and size.
  */
 typedef struct
 {
-  WIDGET_TYPE type;  /**< Type of the widget */
-  int x, y;          /**< Position of the widget (top-left corner) */
-  int width, height; /**< Dimensions of the widget */
+  WIDGET_TYPE type;       /**< Type of the widget */
+  int x, y;               /**< Position of the widget (top-left corner) */
+  int width, height;      /**< Dimensions of the widget */
+  bool is_dirty;          /**< Set when the widget's appearance changed since the last redraw */
+  bool has_moved;         /**< Set when the widget's bounds changed since the window last indexed them */
+  GooeyRect paint_bounds; /**< Area the widget covered when it was last painted */
+  size_t registry_index;  /**< Position of the widget in its window's registry */
 } GooeyWidget;
 
 typedef enum
@@ -112,7 +144,9 @@ typedef enum
   CANVA_DRAW_RECT,
   CANVA_DRAW_LINE,
   CANVA_DRAW_ARC,
-  CANVA_DRAW_SET_FG
+  CANVA_DRAW_SET_FG,
+  CANVA_DRAW_POLYLINE,
+  CANVA_DRAW_POINTS
 } CANVA_DRAW_OP;
 
 /**
@@ -154,27 +188,83 @@ typedef struct
 
 /**
  * @brief A list widget item.
+ *
+ * The text lives in the owning list's string arena, items only keep where it
+ * starts so growing the arena never invalidates them.
  */
 typedef struct
 {
-  char title[256];
-  char description[256];
+  size_t title;       /**< Offset of the NUL-terminated title in the list's arena */
+  size_t description; /**< Offset of the NUL-terminated description in the list's arena */
 } GooeyListItem;
 
+/** Longest title or description, NUL included, a list data provider can hand back. */
+#define GOOEY_LIST_ITEM_TEXT_SIZE 256
+
+/** Number of rows a list in data provider mode keeps cached. */
+#define GOOEY_LIST_CACHE_SIZE 128
+
+/**
+ * @brief Buffer a list data provider fills with the text of one item.
+ */
+typedef struct
+{
+  char title[GOOEY_LIST_ITEM_TEXT_SIZE];
+  char description[GOOEY_LIST_ITEM_TEXT_SIZE];
+} GooeyListItemBuffer;
+
+/**
+ * @brief Fetches the item at `index` into `buffer` for a list in data provider mode.
+ */
+typedef void (*GooeyListItemProvider)(size_t index, GooeyListItemBuffer *buffer);
+
+/**
+ * @brief A row fetched from a list's data provider.
+ */
+typedef struct
+{
+  size_t index;             /**< Index of the cached item */
+  unsigned long last_used;  /**< Value of the list's cache clock when the row was last drawn */
+  bool valid;               /**< Whether the entry holds a row */
+  GooeyListItemBuffer item; /**< Text of the row */
+} GooeyListCacheEntry;
+
+/**
+ * @brief How a list filter query is matched against item titles and descriptions, ignoring ASCII case.
+ */
+typedef enum
+{
+  GOOEY_LIST_FILTER_SUBSTRING, /**< The query appears anywhere in the text */
+  GOOEY_LIST_FILTER_PREFIX     /**< The text starts with the query */
+} GOOEY_LIST_FILTER_MODE;
+
 /**
  * @brief A structure representing a List widget.
  */
 typedef struct
 {
   GooeyWidget core;     /**< Core widget properties */
-  GooeyListItem *items; /**< Items in a list widget */
-  int scroll_offset;    /**< Mouse scroll offset */
-  int thumb_y;          /**< Thumb's y-coordinate */
-  int thumb_height;     /**< Thumb's height */
-  int thumb_width;      /**< Thumb's width */
-  int item_spacing;     /**< Item spacing */
-  size_t item_count;    /**< List widget item count */
-  bool show_separator;  /**< Show or hide separator */
+  GooeyListItem *items;                   /**< Items in a list widget */
+  size_t item_capacity;                   /**< Allocated item slots */
+  char *strings;                          /**< Arena holding the text of every item */
+  size_t strings_size;                    /**< Bytes used in the arena */
+  size_t strings_capacity;                /**< Bytes allocated for the arena */
+  int scroll_offset;                      /**< Mouse scroll offset */
+  int thumb_y;                            /**< Thumb's y-coordinate */
+  int thumb_height;                       /**< Thumb's height */
+  int thumb_width;                        /**< Thumb's width */
+  int item_spacing;                       /**< Item spacing */
+  size_t item_count;                      /**< List widget item count */
+  bool show_separator;                    /**< Show or hide separator */
+  GooeyListItemProvider provider;         /**< Fetches items on demand, NULL when the list stores its items */
+  GooeyListCacheEntry *cache;             /**< Most recently fetched rows, GOOEY_LIST_CACHE_SIZE entries */
+  unsigned long cache_clock;              /**< Bumped on every cache lookup to order entries by recency */
+  char filter[GOOEY_LIST_ITEM_TEXT_SIZE]; /**< Lowercased filter query, empty when the list isn't filtered */
+  size_t filter_length;                   /**< Length of the filter query */
+  GOOEY_LIST_FILTER_MODE filter_mode;     /**< How the filter query is matched */
+  size_t *filtered;                       /**< Indices of the items matching the filter, in list order */
+  size_t filtered_count;                  /**< Number of matching items */
+  size_t filtered_capacity;               /**< Allocated slots in filtered */
   void (*callback)(int index);
 } GooeyList;
 
@@ -323,6 +413,17 @@ typedef struct
   unsigned long color;
 } CanvasSetFGArgs;
 
+/**
+ * @brief Arguments of a polyline or point batch, allocated together with its coordinates.
+ */
+typedef struct
+{
+  size_t count;        /**< Number of points */
+  unsigned long color; /**< Color of the points or line */
+  float size;          /**< Line width or point size, in pixels */
+  float coords[];      /**< The `count` x coordinates followed by the `count` y coordinates, in window space */
+} CanvasDrawPointsArgs;
+
 /**
  * @enum GOOEY_PLOT_TYPE
  * @brief Enumeration of available plot types in Gooey.
@@ -373,6 +474,25 @@ typedef enum
   GOOEY_PLOT_COUNT /**< Total count of plot types */
 } GOOEY_PLOT_TYPE;
 
+/**
+ * @brief How a line plot with more samples than pixel columns is thinned out before drawing.
+ */
+typedef enum
+{
+  GOOEY_PLOT_DECIMATION_NONE, /**< Draw every sample */
+  GOOEY_PLOT_DECIMATION_M4,   /**< Keep the first, minimum, maximum and last sample of each pixel column */
+  GOOEY_PLOT_DECIMATION_LTTB  /**< Largest-Triangle-Three-Buckets, one sample per pixel column */
+} GOOEY_PLOT_DECIMATION;
+
+/**
+ * @brief Where a plot maps its samples to pixels.
+ */
+typedef enum
+{
+  GOOEY_PLOT_RENDER_CPU, /**< Transform the samples on the CPU whenever the layout changes */
+  GOOEY_PLOT_RENDER_GPU  /**< Keep the samples in a GPU buffer and transform them in the vertex shader */
+} GOOEY_PLOT_RENDER;
+
 /**
  * @struct GooeyPlotData
  * @brief Structure to hold plot data and metadata.
@@ -384,10 +504,13 @@ typedef struct
 
   size_t data_count; /**< Number of data points */
 
+  float *size_data;          /**< Marker diameter of each point in pixels for scatter and bubble plots, NULL for the default size */
+  unsigned long *color_data; /**< Marker color of each point for scatter and bubble plots, NULL for the theme's primary color */
+
   char *x_label; /**< Label for X-axis */
-  float x_step;
+  float x_step;  /**< Preferred distance between X axis ticks, 0 or one too small for the plot's width picks one */
   char *y_label; /**< Label for Y-axis */
-  float y_step;
+  float y_step;  /**< Preferred distance between Y axis ticks, 0 or one too small for the plot's height picks one */
   char *title; /**< Plot title */
 
   float max_x_value;
@@ -399,6 +522,169 @@ typedef struct
 
 } GooeyPlotData;
 
+/**
+ * @brief Fixed capacity double-ended queue of sample sequence numbers.
+ */
+typedef struct
+{
+  size_t *items; /**< Ring of sequence numbers */
+  size_t head;   /**< Slot of the front entry */
+  size_t count;  /**< Number of entries */
+} GooeyPlotDeque;
+
+/**
+ * @brief Sliding window of the latest samples appended to a plot.
+ *
+ * Both rings are mirrored: sample `n` is stored at `n % capacity` and again
+ * `capacity` slots later, so the window is always contiguous in memory and
+ * the plot's data can point straight into it.
+ */
+typedef struct
+{
+  float *x;                /**< Mirrored ring of x values, 2 * capacity floats */
+  float *y;                /**< Mirrored ring of y values, 2 * capacity floats */
+  size_t capacity;         /**< Samples kept in the window, 0 when the plot isn't streaming */
+  size_t total;            /**< Samples appended so far, also the sequence number of the next one */
+  GooeyPlotDeque min_y;    /**< Window samples that may become the minimum, in increasing y */
+  GooeyPlotDeque max_y;    /**< Window samples that may become the maximum, in decreasing y */
+} GooeyPlotStream;
+
+/**
+ * @brief Samples posted to a plot from other threads, appended on the window's thread at its next redraw.
+ */
+typedef struct
+{
+  pthread_mutex_t lock; /**< Guards the fields below */
+  float *x;             /**< X values of the posted samples */
+  float *y;             /**< Y values of the posted samples */
+  size_t count;         /**< Number of posted samples */
+  size_t capacity;      /**< Allocated slots in x and y */
+} GooeyPlotInbox;
+
+/** Size of a formatted plot tick label, NUL included. */
+#define GOOEY_PLOT_TICK_LABEL_SIZE 64
+
+/**
+ * @brief Screen space layout of a plot, kept between frames.
+ *
+ * Recomputed only when the data generation, the axis range or the widget's
+ * geometry changes, so redrawing an unchanged plot neither allocates nor
+ * formats anything.
+ */
+typedef struct
+{
+  float *sample_x;                              /**< Screen x of each sample to draw */
+  float *sample_y;                              /**< Screen y of each sample to draw */
+  unsigned char *sample_clip;                   /**< GOOEY_PLOT_CLIP_* outcode of each sample against the plot area */
+  unsigned char *sample_colors;                 /**< RGBA marker color of each sample, filled when the data has colors */
+  size_t sample_count;                          /**< Number of samples to draw */
+  size_t sample_capacity;                       /**< Allocated slots in sample_x and sample_y */
+  unsigned int x_tick_count;                    /**< Number of ticks on the X axis */
+  unsigned int y_tick_count;                    /**< Number of ticks on the Y axis */
+  float x_tick_start;                           /**< Screen x of the first X axis tick */
+  float y_tick_start;                           /**< Screen y of the first Y axis tick */
+  float x_tick_spacing;                         /**< Pixels between two X axis ticks */
+  float y_tick_spacing;                         /**< Pixels between two Y axis ticks, negative as they go up */
+  char (*x_labels)[GOOEY_PLOT_TICK_LABEL_SIZE]; /**< Label of each X axis tick */
+  char (*y_labels)[GOOEY_PLOT_TICK_LABEL_SIZE]; /**< Label of each Y axis tick */
+  unsigned int x_label_capacity;                /**< Allocated X axis labels */
+  unsigned int y_label_capacity;                /**< Allocated Y axis labels */
+  float title_x;                                /**< Screen x the title is centered at */
+
+  bool valid;                                   /**< Whether the fields below describe the current layout */
+  unsigned long data_generation;                /**< Data generation the layout was computed for */
+  GOOEY_PLOT_DECIMATION decimation;             /**< Decimation the samples were picked with */
+  GOOEY_PLOT_RENDER render_mode;                /**< Render mode the layout was computed for, no samples are kept for the GPU */
+  GooeyPlotTransform transform;                 /**< Mapping of data space to the plot area */
+  int x, y, width, height;                      /**< Widget geometry the layout was computed for */
+  float min_x, max_x, min_y, max_y;             /**< Data bounds the layout was computed for */
+  float x_step, y_step;                         /**< Tick steps the layout was computed for */
+  const char *title;                            /**< Title the layout was computed for */
+  double x_origin;                              /**< Value the data's x values are relative to, when labelling the X axis */
+} GooeyPlotLayout;
+
+/**
+ * @brief Copy of a plot's samples kept in a backend series.
+ *
+ * Static data is uploaded again only when its generation changes, streamed
+ * data mirrors the stream's ring buffer and only appended samples are uploaded.
+ */
+typedef struct
+{
+  bool allocated;                /**< Whether `series` holds a backend handle */
+  int series;                    /**< Backend series handle */
+  bool valid;                    /**< Whether the fields below describe the uploaded samples */
+  bool streamed;                 /**< Whether the series mirrors the plot's stream */
+  size_t capacity;               /**< Samples the series was allocated for */
+  unsigned long data_generation; /**< Data generation uploaded, static data only */
+  size_t stream_total;           /**< Stream samples uploaded so far, streamed data only */
+} GooeyPlotGpuSeries;
+
+/**
+ * @brief Float matrix of a heatmap plot and its texture.
+ *
+ * Rows form a ring so a scrolling heatmap only writes, and uploads, the rows
+ * pushed since the last frame. Row `head` is drawn at the bottom.
+ */
+typedef struct
+{
+  float *values;                                   /**< Row-major values, in texture row order */
+  size_t columns;                                  /**< Values per row */
+  size_t rows;                                     /**< Number of rows */
+  size_t head;                                     /**< Texture row drawn at the bottom, the oldest one */
+  float min_value;                                 /**< Value mapped to the first colormap color */
+  float max_value;                                 /**< Value mapped to the last colormap color */
+  unsigned char *dirty_rows;                       /**< Non-zero for texture rows not uploaded yet */
+  bool dirty;                                      /**< Whether any row is dirty */
+  unsigned long colormap[GOOEY_PLOT_COLORMAP_MAX]; /**< Colors from min_value to max_value */
+  size_t colormap_count;                           /**< Number of colormap colors */
+  bool colormap_dirty;                             /**< Whether the colormap changed since it was uploaded */
+  bool allocated;                                  /**< Whether `texture` holds a backend handle */
+  int texture;                                     /**< Backend heatmap handle */
+} GooeyPlotHeatmap;
+
+/**
+ * @brief Histogram bins or density curve computed from a plot's raw samples.
+ *
+ * Computed again only when the data generation or the bin count changes.
+ */
+typedef struct
+{
+  float *x;                      /**< Left edge of each bin, or each grid point of the density */
+  float *y;                      /**< Samples in each bin, or the density at each grid point */
+  size_t count;                  /**< Number of bins or grid points */
+  size_t capacity;               /**< Allocated slots in x and y */
+  float bin_width;               /**< Width of a bin, or distance between two grid points */
+  bool valid;                    /**< Whether the fields below describe the computed distribution */
+  unsigned long data_generation; /**< Data generation the distribution was computed from */
+} GooeyPlotDistribution;
+
+/**
+ * @brief Tick aggregation of candlestick, OHLC and time series plots, and the candles in view.
+ *
+ * The view picks the pyramid level with about one bucket per few pixels, so
+ * the candles in view, and the cost of a redraw, don't grow with the ticks.
+ */
+typedef struct
+{
+  GooeyPlotPyramid pyramid;      /**< Every level of aggregation of the ticks */
+  bool built;                    /**< Whether the pyramid holds the plot's ticks */
+  bool appended;                 /**< Whether ticks were appended since, the pyramid alone holds them then */
+  unsigned long data_generation; /**< Data generation the pyramid is up to date with */
+  bool range_fixed;              /**< Whether the view shows range_start to range_end rather than every tick */
+  double range_start;            /**< Time at the left edge of a fixed view */
+  double range_end;              /**< Time at the right edge of a fixed view */
+  float *xs;                     /**< Four points per candle in view, at the bucket's center, in seconds from view_start */
+  float *ys;                     /**< Open, low, high and close of each candle in view, high first for falling candles */
+  size_t candle_count;           /**< Candles in view */
+  size_t capacity;               /**< Candles xs and ys have room for */
+  float bucket_width;            /**< Width in seconds of the buckets in view */
+  bool view_valid;               /**< Whether the fields below describe the view */
+  unsigned long view_generation; /**< Data generation the view was computed for */
+  double view_start, view_end;   /**< Time range the view was computed for, the data's x bounds are relative to view_start */
+  int view_width;                /**< Plot area width in pixels the view was computed for */
+} GooeyPlotCandles;
+
 /**
  * @struct GooeyPlot
  * @brief Represents a plot widget in the Gooey GUI system.
@@ -411,6 +697,27 @@ typedef struct
 {
   GooeyWidget core;    /**< Base widget properties for integration in the Gooey GUI system */
   GooeyPlotData *data; /**< Pointer to the data structure containing plot-specific information */
+
+  GOOEY_PLOT_DECIMATION decimation;       /**< How line samples are thinned out before drawing */
+  unsigned long data_generation;          /**< Bumped whenever the plot's data changes */
+  float *decimated_x;                     /**< X values of the decimated samples */
+  float *decimated_y;                     /**< Y values of the decimated samples */
+  size_t decimated_count;                 /**< Number of decimated samples */
+  size_t decimated_capacity;              /**< Allocated slots in decimated_x and decimated_y */
+  unsigned long decimated_generation;     /**< data_generation the decimated samples were computed from */
+  int decimated_columns;                  /**< Pixel columns the decimated samples were computed for */
+  GOOEY_PLOT_DECIMATION decimated_mode;   /**< Decimation the decimated samples were computed with */
+  GooeyPlotStream stream;                 /**< Latest appended samples, when the plot is fed incrementally */
+  GooeyPlotInbox inbox;                   /**< Samples posted from other threads, not appended yet */
+  float *owned_x;                         /**< Copy of the data's x values made by the plot, if any */
+  float *owned_y;                         /**< Copy of the data's y values made by the plot, if any */
+  GooeyPlotLayout layout;                 /**< Cached screen space layout */
+  GooeyPlotHeatmap heatmap;               /**< Matrix shown by GOOEY_PLOT_HEATMAP plots */
+  GOOEY_PLOT_RENDER render_mode;          /**< Where the samples are mapped to pixels */
+  GooeyPlotGpuSeries gpu;                 /**< GPU copy of the samples, in GOOEY_PLOT_RENDER_GPU mode */
+  size_t bin_count;                       /**< Histogram bins or density grid points, 0 for the default */
+  GooeyPlotDistribution distribution;     /**< Computed bins or curve of GOOEY_PLOT_HISTOGRAM and GOOEY_PLOT_DENSITY plots */
+  GooeyPlotCandles candles;               /**< Aggregated ticks of GOOEY_PLOT_CANDLESTICK, GOOEY_PLOT_OHLC and GOOEY_PLOT_TIME_SERIES plots */
 } GooeyPlot;
 
 #endif
@@ -35,6 +35,8 @@ typedef struct
     int bearingX;
     int bearingY;
     int advance;
+    float u0, v0; /**< Atlas coordinates of the glyph's top-left corner. */
+    float u1, v1; /**< Atlas coordinates of the glyph's bottom-right corner. */
 } Character;
 
 typedef struct Vertex
@@ -43,13 +45,99 @@ typedef struct Vertex
     vec3 col;
 } Vertex;
 
+/**
+ * @brief Cached framebuffer size and pixel space projection of a window.
+ *
+ * Refreshed only when the window is created or resized, so drawing never has
+ * to query the window system.
+ */
+typedef struct
+{
+    int width;
+    int height;
+    mat4x4 projection; /**< Maps pixel coordinates (origin top-left) to clip space. */
+} WindowViewport;
+
+typedef struct GlyphVertex
+{
+    vec2 pos;
+    vec2 uv;
+    vec3 col;
+} GlyphVertex;
+
+/**
+ * @brief Pipelines a stream run can be drawn with.
+ */
+typedef enum
+{
+    DRAW_PIPELINE_SHAPE, /**< Flat colored primitives made of Vertex. */
+    DRAW_PIPELINE_GLYPH, /**< Atlas sampled text quads made of GlyphVertex. */
+    DRAW_PIPELINE_COUNT
+} DrawPipeline;
+
+/**
+ * @brief GL objects used to draw the runs of one pipeline.
+ */
+typedef struct
+{
+    GLuint program;
+    GLuint vao;
+    GLuint vbo;
+    GLuint texture; /**< Bound to unit 0 before drawing, 0 for none. */
+} DrawPipelineTarget;
+
+/**
+ * @brief Last bindings issued on one GL context, used to skip redundant state changes.
+ *
+ * Bindings are per-context state, so every window keeps its own cache. Code
+ * that binds objects behind the cache's back must call gl_state_reset().
+ */
+typedef struct
+{
+    GLuint program;
+    GLuint vao;
+    GLuint texture; /**< GL_TEXTURE_2D bound on unit 0. */
+} GLStateCache;
+
+/**
+ * @brief A range of consecutive stream vertices drawn with a single call.
+ */
+typedef struct
+{
+    DrawPipeline pipeline; /**< Pipeline the vertices belong to. */
+    GLenum mode;           /**< Primitive mode of the run. */
+    GLint first;           /**< Index of the first vertex of the run in its pipeline's array. */
+    GLsizei count;         /**< Number of vertices in the run. */
+} DrawRun;
+
+/**
+ * @brief Per-window stream gathering the shapes and glyphs of a frame.
+ *
+ * Primitives are appended in submission order, consecutive primitives of the
+ * same pipeline and mode share a run, and each vertex array is uploaded once
+ * on flush, so text and shapes keep their relative stacking order.
+ */
+typedef struct
+{
+    Vertex *vertices;       /**< Shape vertices queued since the last flush. */
+    size_t vertex_count;    /**< Number of queued shape vertices. */
+    size_t vertex_capacity; /**< Allocated shape vertex slots. */
+    GlyphVertex *glyphs;    /**< Glyph vertices queued since the last flush. */
+    size_t glyph_count;     /**< Number of queued glyph vertices. */
+    size_t glyph_capacity;  /**< Allocated glyph vertex slots. */
+    DrawRun *runs;          /**< Draw calls needed to render the queued vertices. */
+    size_t run_count;       /**< Number of queued runs. */
+    size_t run_capacity;    /**< Allocated run slots. */
+} VertexStream;
+
 static const char *rectangle_vertex_shader =
     "#version 330 core\n"
     "layout(location = 0) in vec2 pos;\n"
     "layout(location = 1) in vec3 col;\n"
     "out vec3 color;\n"
+    "uniform mat4 projection;\n"
     "void main() {\n"
-    "    gl_Position = vec4(pos, 0.0, 1.0);\n"
+    "    gl_Position = projection * vec4(pos, 0.0, 1.0);\n"
     "    color = col;\n"
     "}\n";
 
@@ -61,6 +149,178 @@ static const char *rectangle_fragment_shader =
     "    fragment = vec4(color, 1.0);\n"
     "}\n";
 
+/**
+ * @brief Plot samples kept in a GPU buffer: x values in [0, capacity), y values in [capacity, 2 * capacity).
+ */
+typedef struct
+{
+    GLuint vbo;
+    size_t capacity; /**< Samples the buffer holds per axis. */
+    bool in_use;     /**< Whether the slot is handed out. */
+} SeriesBuffer;
+
+/**
+ * @brief Series handed out by a backend, indexed by handle.
+ */
+typedef struct
+{
+    SeriesBuffer *items;
+    size_t count;
+} SeriesPool;
+
+/**
+ * @brief Program mapping series samples to pixels, and its uniform locations.
+ */
+typedef struct
+{
+    GLuint program;
+    GLint projection;
+    GLint scale;
+    GLint offset;
+    GLint clip;
+    GLint point_size;
+    GLint color;
+} SeriesProgram;
+
+static const char *series_vertex_shader =
+    "#version 330 core\n"
+    "layout(location = 0) in float x;\n"
+    "layout(location = 1) in float y;\n"
+    "out vec2 pixel;\n"
+    "uniform mat4 projection;\n"
+    "uniform vec2 scale;\n"
+    "uniform vec2 offset;\n"
+    "uniform float point_size;\n"
+    "void main() {\n"
+    "    pixel = vec2(x, y) * scale + offset;\n"
+    "    gl_Position = projection * vec4(pixel, 0.0, 1.0);\n"
+    "    gl_PointSize = point_size;\n"
+    "}\n";
+
+static const char *series_fragment_shader =
+    "#version 330 core\n"
+    "in vec2 pixel;\n"
+    "out vec4 fragment;\n"
+    "uniform vec4 clip;\n"
+    "uniform vec3 color;\n"
+    "uniform float point_size;\n"
+    "void main() {\n"
+    "    if (pixel.x < clip.x || pixel.x > clip.z || pixel.y < clip.y || pixel.y > clip.w)\n"
+    "        discard;\n"
+    "    if (point_size > 0.0 && length(gl_PointCoord - 0.5) > 0.5)\n"
+    "        discard;\n"
+    "    fragment = vec4(color, 1.0);\n"
+    "}\n";
+
+/**
+ * @brief Float matrix kept in a single channel texture, and the colormap it is drawn through.
+ */
+typedef struct
+{
+    GLuint values;   /**< GL_R32F texture, one texel per value. */
+    GLuint colormap; /**< GL_TEXTURE_1D lookup table the values are mapped through. */
+    size_t columns;
+    size_t rows;
+    bool in_use; /**< Whether the slot is handed out. */
+} HeatmapTexture;
+
+/**
+ * @brief Heatmaps handed out by a backend, indexed by handle.
+ */
+typedef struct
+{
+    HeatmapTexture *items;
+    size_t count;
+} HeatmapPool;
+
+/**
+ * @brief Program drawing a heatmap quad, and its uniform locations.
+ */
+typedef struct
+{
+    GLuint program;
+    GLint projection;
+    GLint rect;
+    GLint row_offset;
+    GLint range;
+} HeatmapProgram;
+
+static const char *heatmap_vertex_shader =
+    "#version 330 core\n"
+    "out vec2 uv;\n"
+    "uniform mat4 projection;\n"
+    "uniform vec4 rect;\n"
+    "void main() {\n"
+    "    vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);\n"
+    "    uv = corner;\n"
+    "    vec2 pixel = rect.xy + vec2(corner.x, 1.0 - corner.y) * rect.zw;\n"
+    "    gl_Position = projection * vec4(pixel, 0.0, 1.0);\n"
+    "}\n";
+
+static const char *heatmap_fragment_shader =
+    "#version 330 core\n"
+    "in vec2 uv;\n"
+    "out vec4 fragment;\n"
+    "uniform sampler2D values;\n"
+    "uniform sampler1D colormap;\n"
+    "uniform float row_offset;\n"
+    "uniform vec2 range;\n"
+    "void main() {\n"
+    "    float value = texture(values, vec2(uv.x, uv.y + row_offset)).r;\n"
+    "    float t = clamp((value - range.x) * range.y, 0.0, 1.0);\n"
+    "    float size = float(textureSize(colormap, 0));\n"
+    "    fragment = vec4(texture(colormap, (t * (size - 1.0) + 0.5) / size).rgb, 1.0);\n"
+    "}\n";
+
+/**
+ * @brief Program drawing instanced round markers, and its uniform location.
+ */
+typedef struct
+{
+    GLuint program;
+    GLint projection;
+} MarkerProgram;
+
+/** Attribute locations of the per-marker values. */
+enum
+{
+    MARKER_ATTRIB_X,
+    MARKER_ATTRIB_Y,
+    MARKER_ATTRIB_SIZE,
+    MARKER_ATTRIB_COLOR
+};
+
+static const char *marker_vertex_shader =
+    "#version 330 core\n"
+    "layout(location = 0) in float x;\n"
+    "layout(location = 1) in float y;\n"
+    "layout(location = 2) in float size;\n"
+    "layout(location = 3) in vec4 color;\n"
+    "out vec2 local;\n"
+    "flat out float radius;\n"
+    "flat out vec3 marker_color;\n"
+    "uniform mat4 projection;\n"
+    "void main() {\n"
+    "    vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1) * 2.0 - 1.0;\n"
+    "    radius = size * 0.5;\n"
+    "    local = corner * (radius + 1.0);\n"
+    "    marker_color = color.rgb;\n"
+    "    gl_Position = projection * vec4(vec2(x, y) + local, 0.0, 1.0);\n"
+    "}\n";
+
+static const char *marker_fragment_shader =
+    "#version 330 core\n"
+    "in vec2 local;\n"
+    "flat in float radius;\n"
+    "flat in vec3 marker_color;\n"
+    "out vec4 fragment;\n"
+    "void main() {\n"
+    "    float coverage = clamp(radius - length(local) + 0.5, 0.0, 1.0);\n"
+    "    if (coverage <= 0.0)\n"
+    "        discard;\n"
+    "    fragment = vec4(marker_color, coverage);\n"
+    "}\n";
+
 static const char *text_vertex_shader_source = "#version 330 core\n"
                                                "layout(location = 0) in vec4 vertex;\n"
                                                "out vec2 TexCoords;\n"
@@ -79,12 +339,184 @@ static const char *text_fragment_shader_source = "#version 330 core\n"
                                                  "    float alpha = texture(text, TexCoords).r;\n"
                                                  "    color = vec4(textColor, alpha);\n"
                                                  "}\n";
+
+static const char *glyph_vertex_shader_source = "#version 330 core\n"
+                                                "layout(location = 0) in vec2 pos;\n"
+                                                "layout(location = 1) in vec2 uv;\n"
+                                                "layout(location = 2) in vec3 col;\n"
+                                                "out vec2 TexCoords;\n"
+                                                "out vec3 textColor;\n"
+                                                "uniform mat4 projection;\n"
+                                                "void main() {\n"
+                                                "    gl_Position = projection * vec4(pos, 0.0, 1.0);\n"
+                                                "    TexCoords = uv;\n"
+                                                "    textColor = col;\n"
+                                                "}\n";
+
+static const char *glyph_fragment_shader_source = "#version 330 core\n"
+                                                  "in vec2 TexCoords;\n"
+                                                  "in vec3 textColor;\n"
+                                                  "out vec4 color;\n"
+                                                  "uniform sampler2D atlas;\n"
+                                                  "void main() {\n"
+                                                  "    float alpha = texture(atlas, TexCoords).r;\n"
+                                                  "    color = vec4(textColor, alpha);\n"
+                                                  "}\n";
 void check_shader_link(GLuint program);
 void check_shader_compile(GLuint shader);
-void get_window_size(GLFWwindow *window, int *window_width, int *window_height);
-void convert_coords_to_ndc(GLFWwindow *window, float *ndc_x, float *ndc_y, int x, int y);
-void convert_dimension_to_ndc(GLFWwindow *window, float *ndc_w, float *ndc_h, int width, int height);
+
+/**
+ * @brief Compiles and links a vertex and fragment shader pair, exiting with the log if either fails.
+ */
+GLuint compile_program(const char *vertex_source, const char *fragment_source);
+void set_window_viewport(WindowViewport *viewport, int width, int height);
+void gl_state_reset(GLStateCache *state);
+void gl_state_use_program(GLStateCache *state, GLuint program);
+void gl_state_bind_vertex_array(GLStateCache *state, GLuint vao);
+void gl_state_bind_texture(GLStateCache *state, GLuint texture);
 void convert_hex_to_rgb(vec3 *rgb, unsigned int color_hex);
 const char *LookupString(int keycode);
 
+/**
+ * @brief Primitive mode and vertex count a polyline of `count` points and `width` pixels is built with.
+ *
+ * Hairlines are a single GL_LINE_STRIP. Core profiles only guarantee 1 pixel
+ * wide lines, so wider ones are built from one quad (two triangles) per segment.
+ */
+void polyline_geometry(size_t count, float width, GLenum *mode, size_t *vertex_count);
+
+/**
+ * @brief Fills `vertices` with the geometry described by polyline_geometry().
+ */
+void polyline_build(Vertex *vertices, const float *xs, const float *ys, size_t count, float width, vec3 color);
+
+/**
+ * @brief Primitive mode and vertex count `count` points of `size` pixels are built with.
+ *
+ * Points up to 1 pixel are GL_POINTS, larger ones are quads (two triangles) so
+ * the shape shader doesn't have to write gl_PointSize.
+ */
+void points_geometry(size_t count, float size, GLenum *mode, size_t *vertex_count);
+
+/**
+ * @brief Fills `vertices` with the geometry described by points_geometry().
+ */
+void points_build(Vertex *vertices, const float *xs, const float *ys, size_t count, float size, vec3 color);
+
+void series_program_init(SeriesProgram *program);
+
+/**
+ * @brief Hands out an unused series slot, growing the pool if needed.
+ *
+ * @return The series' handle, -1 if the pool couldn't grow.
+ */
+int series_pool_acquire(SeriesPool *pool);
+void series_pool_release(SeriesPool *pool, int series);
+void series_pool_free(SeriesPool *pool);
+
+/**
+ * @brief Looks up a series handed out by the pool, NULL for an unknown handle.
+ */
+SeriesBuffer *series_pool_get(SeriesPool *pool, int series);
+
+/**
+ * @brief Writes samples [offset, offset + count) of a series, reallocating its buffer when `capacity` changes.
+ */
+bool series_upload(SeriesBuffer *series, const float *xs, const float *ys, size_t offset, size_t count, size_t capacity);
+
+/**
+ * @brief Draws samples [first, first + count) of a series with the given pixel space mapping.
+ *
+ * Binds its program, `vao` and the series' buffer directly, callers keeping a
+ * GLStateCache must reset it afterwards.
+ *
+ * @param vao Vertex array of the current context used for series.
+ * @param projection Projection of the window drawn to.
+ * @param point_size 0 draws a line strip, anything else square points of that size.
+ */
+void series_draw(const SeriesProgram *program, GLuint vao, const SeriesBuffer *series, size_t first, size_t count,
+                 const GooeyPlotTransform *transform, float point_size, vec3 color, mat4x4 projection);
+
+void heatmap_program_init(HeatmapProgram *program);
+
+/**
+ * @brief Hands out an unused heatmap slot, growing the pool if needed.
+ *
+ * @return The heatmap's handle, -1 if the pool couldn't grow.
+ */
+int heatmap_pool_acquire(HeatmapPool *pool);
+HeatmapTexture *heatmap_pool_get(HeatmapPool *pool, int heatmap);
+void heatmap_pool_release(HeatmapPool *pool, int heatmap);
+void heatmap_pool_free(HeatmapPool *pool);
+
+/**
+ * @brief Writes rows [first_row, first_row + row_count) of a `columns` x `rows` heatmap.
+ *
+ * A new size reallocates the texture and drops its content.
+ *
+ * @param values Row-major values of the written rows only.
+ */
+bool heatmap_upload_rows(HeatmapTexture *heatmap, const float *values, size_t columns, size_t rows, size_t first_row, size_t row_count);
+
+/**
+ * @brief Replaces the heatmap's colormap with `count` evenly spaced colors, interpolated in between.
+ */
+bool heatmap_upload_colormap(HeatmapTexture *heatmap, const unsigned long *colors, size_t count);
+
+/**
+ * @brief Draws the heatmap stretched over a pixel rectangle, row 0 at the bottom.
+ *
+ * Binds its program, `vao` and textures directly, callers keeping a
+ * GLStateCache must reset it afterwards.
+ *
+ * @param vao Attribute-less vertex array of the current context.
+ * @param first_row Texture row drawn at the bottom, the rows above it wrap around.
+ * @param min_value Value mapped to the first colormap entry.
+ * @param max_value Value mapped to the last colormap entry.
+ */
+void heatmap_draw(const HeatmapProgram *program, GLuint vao, const HeatmapTexture *heatmap, float x, float y, float width, float height,
+                  size_t first_row, float min_value, float max_value, mat4x4 projection);
+
+void marker_program_init(MarkerProgram *program);
+
+/**
+ * @brief Draws `count` round markers with one instanced draw of a quad.
+ *
+ * The per-marker arrays are copied as they are into consecutive ranges of
+ * `vbo`, a NULL `sizes` or `colors` array is replaced by a constant attribute.
+ * Binds its program, `vao` and `vbo` directly, callers keeping a GLStateCache
+ * must reset it afterwards.
+ *
+ * @param sizes Diameter of each marker in pixels, NULL to use `size` for all.
+ * @param colors RGBA bytes of each marker, NULL to use `color` for all.
+ */
+void markers_draw(const MarkerProgram *program, GLuint vao, GLuint vbo, const float *xs, const float *ys, size_t count,
+                  const float *sizes, const unsigned char *colors, float size, vec3 color, mat4x4 projection);
+
+/**
+ * @brief Reserves room for `count` shape vertices at the end of the stream.
+ *
+ * Only GL_TRIANGLES, GL_LINES and GL_POINTS runs are merged with the previous
+ * run, any other mode starts a run of its own.
+ *
+ * @return Pointer to the reserved vertices, NULL if the stream couldn't grow.
+ */
+Vertex *vertex_stream_reserve(VertexStream *stream, GLenum mode, size_t count);
+
+/**
+ * @brief Reserves room for `count` glyph vertices (GL_TRIANGLES) at the end of the stream.
+ *
+ * @return Pointer to the reserved vertices, NULL if the stream couldn't grow.
+ */
+GlyphVertex *vertex_stream_reserve_glyphs(VertexStream *stream, size_t count);
+
+/**
+ * @brief Uploads each pipeline's vertices in one call, draws every run in order, then empties the stream.
+ *
+ * @param targets GL objects of each pipeline, indexed by DrawPipeline.
+ * @param state Binding cache of the context the stream is flushed on.
+ */
+void vertex_stream_flush(VertexStream *stream, const DrawPipelineTarget targets[DRAW_PIPELINE_COUNT], GLStateCache *state);
+void vertex_stream_free(VertexStream *stream);
+
 #endif // BACKEND_UTILS_H
@@ -0,0 +1,56 @@
+/*
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file gooey_parallel_internal.h
+ * @brief Splitting a loop over large arrays between a few short-lived threads.
+ */
+
+#ifndef GOOEY_PARALLEL_INTERNAL_H
+#define GOOEY_PARALLEL_INTERNAL_H
+
+#include <stddef.h>
+
+/** Most workers a loop is split between. */
+#define GOOEY_PARALLEL_MAX_WORKERS 16
+
+/**
+ * @brief Number of workers to split `count` elements between.
+ *
+ * One below `threshold` elements, otherwise one per `min_chunk` elements,
+ * bounded by the online CPUs and GOOEY_PARALLEL_MAX_WORKERS.
+ */
+size_t GooeyParallel_WorkerCount(size_t count, size_t threshold, size_t min_chunk);
+
+/**
+ * @brief Share of [0, count) worker `worker` out of `worker_count` takes, as [*begin, *end).
+ *
+ * Shares are contiguous and in worker order.
+ */
+void GooeyParallel_Share(size_t count, size_t worker_count, size_t worker, size_t *begin, size_t *end);
+
+/**
+ * @brief Calls `run` on each of `job_count` jobs laid out `job_size` bytes apart, and waits for all of them.
+ *
+ * @param jobs First job, at most GOOEY_PARALLEL_MAX_WORKERS of them.
+ * @param job_size Size of one job in bytes.
+ * @param job_count Number of jobs.
+ * @param run Called with a pointer to each job, on its own thread.
+ */
+void GooeyParallel_For(void *jobs, size_t job_size, size_t job_count, void *(*run)(void *));
+
+#endif /* GOOEY_PARALLEL_INTERNAL_H */
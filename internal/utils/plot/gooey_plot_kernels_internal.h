@@ -0,0 +1,62 @@
+/*
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file gooey_plot_kernels_internal.h
+ * @brief Bulk numeric kernels used by the plot widget.
+ *
+ * Each kernel has an AVX2, an SSE2 and a scalar implementation, the fastest
+ * one the CPU supports is picked on first use.
+ */
+
+#ifndef GOOEY_PLOT_KERNELS_INTERNAL_H
+#define GOOEY_PLOT_KERNELS_INTERNAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "gooey_types_internal.h"
+
+/**
+ * @brief Outcode bits of a transformed point, set for each edge of the clip rectangle it lies beyond.
+ */
+#define GOOEY_PLOT_CLIP_LEFT 0x1
+#define GOOEY_PLOT_CLIP_RIGHT 0x2
+#define GOOEY_PLOT_CLIP_TOP 0x4
+#define GOOEY_PLOT_CLIP_BOTTOM 0x8
+
+/**
+ * @brief Maps `count` points to pixel space in a single pass.
+ *
+ * @param transform The mapping and clip rectangle.
+ * @param xs X values in data space.
+ * @param ys Y values in data space.
+ * @param count Number of points.
+ * @param out_x Receives the pixel x of each point, may alias `xs`.
+ * @param out_y Receives the pixel y of each point, may alias `ys`.
+ * @param clip Receives the GOOEY_PLOT_CLIP_* outcode of each point, NULL if not needed.
+ */
+void GooeyPlotKernels_Transform(const GooeyPlotTransform *transform, const float *xs, const float *ys, size_t count,
+                                float *out_x, float *out_y, uint8_t *clip);
+
+/**
+ * @brief Whether the values are in non-decreasing order, in a single pass that stops at the first descent.
+ *
+ * NaNs compare as in order with their neighbours.
+ */
+bool GooeyPlotKernels_IsSorted(const float *values, size_t count);
+
+#endif /* GOOEY_PLOT_KERNELS_INTERNAL_H */
@@ -0,0 +1,103 @@
+/*
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file gooey_plot_pyramid_internal.h
+ * @brief Multi-resolution open-high-low-close aggregation of tick data.
+ *
+ * Ticks are aggregated into buckets of 1 s up to 4 weeks. Every bucket width
+ * divides the next one, so each level is built from the level below it and
+ * appending ticks only rebuilds the last bucket of every level.
+ */
+
+#ifndef GOOEY_PLOT_PYRAMID_INTERNAL_H
+#define GOOEY_PLOT_PYRAMID_INTERNAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Number of bucket widths in a pyramid. */
+#define GOOEY_PLOT_PYRAMID_LEVELS 11
+
+/**
+ * @brief Open, high, low and close of the ticks falling in one bucket.
+ */
+typedef struct
+{
+    double time; /**< Start of the bucket, in seconds */
+    float open;  /**< First tick */
+    float high;  /**< Highest tick */
+    float low;   /**< Lowest tick */
+    float close; /**< Last tick */
+} GooeyPlotCandle;
+
+/**
+ * @brief Non-empty buckets of one width, in time order.
+ */
+typedef struct
+{
+    GooeyPlotCandle *candles;
+    size_t count;
+    size_t capacity;
+} GooeyPlotCandleLevel;
+
+/**
+ * @brief Every level of aggregation of a tick series, zero-initialized when empty.
+ */
+typedef struct
+{
+    GooeyPlotCandleLevel levels[GOOEY_PLOT_PYRAMID_LEVELS]; /**< From the finest to the coarsest buckets */
+    size_t tick_count;                                      /**< Ticks aggregated so far */
+    double last_time;                                       /**< Time of the latest tick */
+} GooeyPlotPyramid;
+
+/**
+ * @brief Width in seconds of the buckets of a level.
+ */
+double GooeyPlotPyramid_BucketWidth(size_t level);
+
+/**
+ * @brief Aggregates ticks into every level.
+ *
+ * Ticks must come in non-decreasing time order, not before the latest tick
+ * already aggregated. Ticks with a non-finite time or price are skipped.
+ *
+ * @param times Time of each tick, in seconds. Doubles keep epoch times to the second.
+ * @param prices Price of each tick.
+ * @param count Number of ticks.
+ * @return false if memory ran out.
+ */
+bool GooeyPlotPyramid_Append(GooeyPlotPyramid *pyramid, const double *times, const float *prices, size_t count);
+
+/**
+ * @brief Finest level whose buckets are at least `min_width` seconds wide, the coarsest one if none is.
+ */
+size_t GooeyPlotPyramid_PickLevel(double min_width);
+
+/**
+ * @brief Index of the first candle of a level whose bucket ends after `time`, in O(log n).
+ */
+size_t GooeyPlotPyramid_Find(const GooeyPlotPyramid *pyramid, size_t level, double time);
+
+/**
+ * @brief Drops every tick, keeping the memory for the next ones.
+ */
+void GooeyPlotPyramid_Clear(GooeyPlotPyramid *pyramid);
+
+void GooeyPlotPyramid_Free(GooeyPlotPyramid *pyramid);
+
+#endif /* GOOEY_PLOT_PYRAMID_INTERNAL_H */
@@ -0,0 +1,46 @@
+/*
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file gooey_plot_sort_internal.h
+ * @brief Sorting of plot samples by x.
+ */
+
+#ifndef GOOEY_PLOT_SORT_INTERNAL_H
+#define GOOEY_PLOT_SORT_INTERNAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Sorts `keys` in ascending order, moving `values` and `order` along with them.
+ *
+ * A stable LSD radix sort over the keys' bits, flipped so that they order
+ * like the floats they hold, in three passes of 11 bits. Passes in which
+ * every key has the same digit are skipped, and large arrays are counted
+ * and scattered by several threads. Negative NaNs end up first, positive
+ * NaNs last.
+ *
+ * @param keys Values to sort.
+ * @param values Values moved along with the keys.
+ * @param order Also moved along with the keys, NULL if not needed.
+ * @param count Number of keys.
+ * @return false if memory ran out, the arrays are left untouched then.
+ */
+bool GooeyPlotSort_ByKey(float *keys, float *values, size_t *order, size_t count);
+
+#endif /* GOOEY_PLOT_SORT_INTERNAL_H */
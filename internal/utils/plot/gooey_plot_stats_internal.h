@@ -0,0 +1,80 @@
+/*
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file gooey_plot_stats_internal.h
+ * @brief Distribution statistics computed from raw plot samples.
+ *
+ * Passes over the samples are split between threads once there are enough of
+ * them, non-finite samples are ignored throughout.
+ */
+
+#ifndef GOOEY_PLOT_STATS_INTERNAL_H
+#define GOOEY_PLOT_STATS_INTERNAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Summary of a set of samples.
+ */
+typedef struct
+{
+    size_t count;    /**< Number of finite samples */
+    float min;       /**< Smallest finite sample */
+    float max;       /**< Largest finite sample */
+    double mean;     /**< Mean of the finite samples */
+    double variance; /**< Population variance of the finite samples */
+} GooeyPlotSummary;
+
+/**
+ * @brief Computes the count, bounds, mean and variance of the samples in one pass.
+ *
+ * @return false if none of the samples is finite.
+ */
+bool GooeyPlotStats_Summarize(const float *samples, size_t count, GooeyPlotSummary *summary);
+
+/**
+ * @brief Counts the samples falling in each of `bin_count` equal bins spanning [min, max].
+ *
+ * Every thread fills private bins, they are added up once all are done.
+ * Samples outside [min, max] are left out, `max` itself goes in the last bin.
+ *
+ * @return false if memory ran out.
+ */
+bool GooeyPlotStats_Histogram(const float *samples, size_t count, float min, float max, size_t *bins, size_t bin_count);
+
+/**
+ * @brief Gaussian kernel density estimate of the samples at `grid_size` evenly spaced points spanning [min, max].
+ *
+ * The samples are linearly binned onto the grid, then the bins are convolved
+ * with the kernel through an FFT, which costs O(n + m log m) instead of the
+ * O(n * m) of summing the kernel over every sample.
+ *
+ * @param bandwidth Standard deviation of the kernel, in data units.
+ * @param density Receives the estimated density at each grid point.
+ * @param grid_size Number of grid points, at least 2.
+ * @return false if memory ran out.
+ */
+bool GooeyPlotStats_Density(const float *samples, size_t count, float min, float max, float bandwidth, float *density, size_t grid_size);
+
+/**
+ * @brief Silverman's rule of thumb bandwidth for a Gaussian kernel.
+ */
+float GooeyPlotStats_DefaultBandwidth(const GooeyPlotSummary *summary);
+
+#endif /* GOOEY_PLOT_STATS_INTERNAL_H */
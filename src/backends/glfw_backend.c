@@ -15,18 +15,33 @@
  along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 #include "utils/backends/backend_utils.h"
+#include "core/gooey_event_queue.h"
 
 typedef struct userPtr
 {
     int id;
 } userPtr;
 
+/**
+ * @brief Offscreen color buffer a window is drawn into.
+ *
+ * Its content survives buffer swaps, which lets a redraw repaint only the
+ * damaged region before blitting the whole frame to the window.
+ */
+typedef struct
+{
+    GLuint fbo;
+    GLuint color_buffer;
+    int width;
+    int height;
+} RenderTarget;
+
 typedef struct
 {
     GooeyEvent *current_event;
     GLFWwindow *window;
     GLFWwindow **child_windows;
-    GLFWcursor *cursor;
+    GLFWcursor *cursors[GOOEY_CURSOR_NOT_ALLOWED + 1]; /**< Standard cursors, created on first use. */
     GLuint *text_programs;
     GLuint shape_program;
     GLuint text_vbo;
@@ -34,13 +49,32 @@ typedef struct
     userPtr *user_ptrs;
     GLuint *text_vaos;
     GLuint *shape_vaos;
+    GLuint *series_vaos;         /**< Per-window vertex array plot series are drawn with. */
+    SeriesProgram series_program;
+    SeriesPool series;           /**< GPU resident plot series, shared by every window. */
+    GLuint marker_vbo;           /**< Per-marker values of the markers being drawn, shared by every window. */
+    GLuint *marker_vaos;         /**< Per-window vertex array markers are drawn with. */
+    MarkerProgram marker_program;
+    GLuint *heatmap_vaos;        /**< Per-window attribute-less vertex array heatmaps are drawn with. */
+    HeatmapProgram heatmap_program;
+    HeatmapPool heatmaps;        /**< Float textures of heatmap plots, shared by every window. */
+    VertexStream *shape_streams; /**< Per-window shapes and glyphs waiting for the next flush. */
+    WindowViewport *viewports;   /**< Per-window framebuffer size, refreshed on resize only. */
+    GLStateCache *gl_states;     /**< Per-window bindings of each context. */
+    RenderTarget *render_targets; /**< Per-window preserved back buffer. */
+    GooeyRect *clip_rects;       /**< Per-window scissor of the frame being drawn, empty for none. */
+    int current_window;          /**< Window whose context is current, -1 for none. */
+    int shape_projection_window; /**< Window whose projection the shared shape program holds, -1 for none. */
+    GLint shape_projection_location;
     mat4x4 projection;
     GLuint text_fragment_shader;
     GLuint text_vertex_shader;
+    GLuint glyph_atlas; /**< Single texture holding every loaded glyph. */
     Character characters[128];
     char font_path[256];
     int window_count;
-    bool inhibit_reset; /**< useful for continuesly happening events like dragging a slider. */
+    int swap_interval; /**< Swap interval applied to every window's context. */
+    GooeyEventQueue event_queue; /**< Events queued by the callbacks until the run loop pops them. */
     unsigned int selected_color;
 } GooeyBackendContext;
 ;
@@ -54,12 +88,12 @@ void glfw_setup_shared()
     glGenBuffers(1, &ctx.text_vbo);
 
     ctx.text_vertex_shader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(ctx.text_vertex_shader, 1, &text_vertex_shader_source, NULL);
+    glShaderSource(ctx.text_vertex_shader, 1, &glyph_vertex_shader_source, NULL);
     glCompileShader(ctx.text_vertex_shader);
     check_shader_compile(ctx.text_vertex_shader);
 
     ctx.text_fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(ctx.text_fragment_shader, 1, &text_fragment_shader_source, NULL);
+    glShaderSource(ctx.text_fragment_shader, 1, &glyph_fragment_shader_source, NULL);
     glCompileShader(ctx.text_fragment_shader);
     check_shader_compile(ctx.text_fragment_shader);
 
@@ -80,9 +114,32 @@ void glfw_setup_shared()
     glAttachShader(ctx.shape_program, shape_fragment_shader);
     glLinkProgram(ctx.shape_program);
     check_shader_link(ctx.shape_program);
+    ctx.shape_projection_location = glGetUniformLocation(ctx.shape_program, "projection");
 
     glDeleteShader(shape_vertex_shader);
     glDeleteShader(shape_fragment_shader);
+
+    series_program_init(&ctx.series_program);
+    marker_program_init(&ctx.marker_program);
+    glGenBuffers(1, &ctx.marker_vbo);
+    heatmap_program_init(&ctx.heatmap_program);
+}
+
+static GLFWwindow *glfw_get_window(int window_id)
+{
+    return window_id == 0 ? ctx.window : ctx.child_windows[window_id - 1];
+}
+
+/**
+ * @brief Makes the window's context current, unless it already is.
+ */
+static void glfw_bind_window(int window_id)
+{
+    if (ctx.current_window == window_id)
+        return;
+
+    glfwMakeContextCurrent(glfw_get_window(window_id));
+    ctx.current_window = window_id;
 }
 
 void setup_seperate_vao(int window_id)
@@ -99,9 +156,12 @@ void setup_seperate_vao(int window_id)
 
     glBindVertexArray(text_vao);
     glBindBuffer(GL_ARRAY_BUFFER, ctx.text_vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
     glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), 0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(GlyphVertex), (void *)offsetof(GlyphVertex, pos));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(GlyphVertex), (void *)offsetof(GlyphVertex, uv));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(GlyphVertex), (void *)offsetof(GlyphVertex, col));
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     ctx.text_vaos[window_id] = text_vao;
     glBindVertexArray(0);
@@ -119,51 +179,82 @@ void setup_seperate_vao(int window_id)
     glEnableVertexAttribArray(col_attrib);
     glVertexAttribPointer(col_attrib, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, col));
     ctx.shape_vaos[window_id] = shape_vao;
+
+    glGenVertexArrays(1, &ctx.series_vaos[window_id]);
+    glGenVertexArrays(1, &ctx.marker_vaos[window_id]);
+    glGenVertexArrays(1, &ctx.heatmap_vaos[window_id]);
+
+    gl_state_reset(&ctx.gl_states[window_id]);
 }
 
-void glfw_fill_rectangle(int x, int y, int width, int height, long unsigned int color, int window_id)
+static void set_vertex(Vertex *vertex, float x, float y, vec3 color)
 {
+    vertex->pos[0] = x;
+    vertex->pos[1] = y;
+    vertex->col[0] = color[0];
+    vertex->col[1] = color[1];
+    vertex->col[2] = color[2];
+}
 
-    GLFWwindow *target_window = (window_id == 0) ? ctx.window : ctx.child_windows[window_id - 1];
-    glfwMakeContextCurrent(target_window);
-    float ndc_x, ndc_y;
-    float ndc_width, ndc_height;
-    vec3 color_rgb;
+static void set_glyph_vertex(GlyphVertex *vertex, float x, float y, float u, float v, vec3 color)
+{
+    vertex->pos[0] = x;
+    vertex->pos[1] = y;
+    vertex->uv[0] = u;
+    vertex->uv[1] = v;
+    vertex->col[0] = color[0];
+    vertex->col[1] = color[1];
+    vertex->col[2] = color[2];
+}
 
-    convert_coords_to_ndc(target_window, &ndc_x, &ndc_y, x, y);
-    convert_dimension_to_ndc(target_window, &ndc_width, &ndc_height, width, height);
-    convert_hex_to_rgb(&color_rgb, color);
+static void glfw_flush_stream(int window_id)
+{
+    DrawPipelineTarget targets[DRAW_PIPELINE_COUNT] = {
+        [DRAW_PIPELINE_SHAPE] = {.program = ctx.shape_program, .vao = ctx.shape_vaos[window_id], .vbo = ctx.shape_vbo},
+        [DRAW_PIPELINE_GLYPH] = {.program = ctx.text_programs[window_id], .vao = ctx.text_vaos[window_id], .vbo = ctx.text_vbo, .texture = ctx.glyph_atlas},
+    };
 
-    Vertex vertices[6];
+    GLStateCache *state = &ctx.gl_states[window_id];
 
-    for (int i = 0; i < 6; i++)
+    // The shape program is shared by every window, so its projection is only reloaded when another window drew last.
+    if (ctx.shape_projection_window != window_id)
     {
-        vertices[i].col[0] = color_rgb[0];
-        vertices[i].col[1] = color_rgb[1];
-        vertices[i].col[2] = color_rgb[2];
+        gl_state_use_program(state, ctx.shape_program);
+        glUniformMatrix4fv(ctx.shape_projection_location, 1, GL_FALSE, (const GLfloat *)ctx.viewports[window_id].projection);
+        ctx.shape_projection_window = window_id;
     }
 
-    vertices[0].pos[0] = ndc_x;
-    vertices[0].pos[1] = ndc_y;
-    vertices[1].pos[0] = ndc_x + ndc_width;
-    vertices[1].pos[1] = ndc_y;
-    vertices[2].pos[0] = ndc_x;
-    vertices[2].pos[1] = ndc_y + ndc_height;
+    vertex_stream_flush(&ctx.shape_streams[window_id], targets, state);
+}
 
-    vertices[3].pos[0] = ndc_x + ndc_width;
-    vertices[3].pos[1] = ndc_y;
-    vertices[4].pos[0] = ndc_x + ndc_width;
-    vertices[4].pos[1] = ndc_y + ndc_height;
-    vertices[5].pos[0] = ndc_x;
-    vertices[5].pos[1] = ndc_y + ndc_height;
+/**
+ * @brief Gets a window ready for a draw call that bypasses the vertex stream (markers, series, heatmaps).
+ *
+ * Whatever was queued before the draw is flushed first so it lands below it.
+ */
+static void glfw_begin_direct_draw(int window_id)
+{
+    glfw_bind_window(window_id);
+    glfw_flush_stream(window_id);
+}
 
-    glUseProgram(ctx.shape_program);
+void glfw_fill_rectangle(int x, int y, int width, int height, long unsigned int color, int window_id)
+{
+    vec3 color_rgb;
 
-    glBindBuffer(GL_ARRAY_BUFFER, ctx.shape_vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
+    convert_hex_to_rgb(&color_rgb, color);
 
-    glBindVertexArray(ctx.shape_vaos[window_id]);
-    glDrawArrays(GL_TRIANGLES, 0, 6);
+    Vertex *vertices = vertex_stream_reserve(&ctx.shape_streams[window_id], GL_TRIANGLES, 6);
+    if (!vertices)
+        return;
+
+    set_vertex(&vertices[0], x, y, color_rgb);
+    set_vertex(&vertices[1], x + width, y, color_rgb);
+    set_vertex(&vertices[2], x, y + height, color_rgb);
+
+    set_vertex(&vertices[3], x + width, y, color_rgb);
+    set_vertex(&vertices[4], x + width, y + height, color_rgb);
+    set_vertex(&vertices[5], x, y + height, color_rgb);
 }
 void glfw_set_foreground(long unsigned int color)
 {
@@ -172,196 +263,297 @@ void glfw_set_foreground(long unsigned int color)
 
 void glfw_draw_rectangle(int x, int y, int width, int height, long unsigned int color, int window_id)
 {
-    GLFWwindow *target_window = (window_id == 0) ? ctx.window : ctx.child_windows[window_id - 1];
-    glfwMakeContextCurrent(target_window);
-    float ndc_x, ndc_y;
-    float ndc_width, ndc_height;
     vec3 color_rgb;
 
-    convert_coords_to_ndc(target_window, &ndc_x, &ndc_y, x, y);
-    convert_dimension_to_ndc(target_window, &ndc_width, &ndc_height, width, height);
     convert_hex_to_rgb(&color_rgb, color);
 
-    Vertex vertices[4];
+    // The outline is queued as 4 separate segments so it can share a run with other lines.
+    Vertex *vertices = vertex_stream_reserve(&ctx.shape_streams[window_id], GL_LINES, 8);
+    if (!vertices)
+        return;
 
-    for (int i = 0; i < 4; i++)
-    {
-        vertices[i].col[0] = color_rgb[0];
-        vertices[i].col[1] = color_rgb[1];
-        vertices[i].col[2] = color_rgb[2];
-    }
+    set_vertex(&vertices[0], x, y, color_rgb);
+    set_vertex(&vertices[1], x + width, y, color_rgb);
+    set_vertex(&vertices[2], x + width, y, color_rgb);
+    set_vertex(&vertices[3], x + width, y + height, color_rgb);
+    set_vertex(&vertices[4], x + width, y + height, color_rgb);
+    set_vertex(&vertices[5], x, y + height, color_rgb);
+    set_vertex(&vertices[6], x, y + height, color_rgb);
+    set_vertex(&vertices[7], x, y, color_rgb);
+}
 
-    vertices[0].pos[0] = ndc_x;
-    vertices[0].pos[1] = ndc_y;
-    vertices[1].pos[0] = ndc_x + ndc_width;
-    vertices[1].pos[1] = ndc_y;
-    vertices[2].pos[0] = ndc_x + ndc_width;
-    vertices[2].pos[1] = ndc_y + ndc_height;
+void glfw_draw_line(int x1, int y1, int x2, int y2, long unsigned int color, int window_id)
+{
+    vec3 color_rgb;
 
-    vertices[3].pos[0] = ndc_x;
-    vertices[3].pos[1] = ndc_y + ndc_height;
-    glUseProgram(ctx.shape_program);
+    convert_hex_to_rgb(&color_rgb, color);
 
-    glBindBuffer(GL_ARRAY_BUFFER, ctx.shape_vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
+    Vertex *vertices = vertex_stream_reserve(&ctx.shape_streams[window_id], GL_LINES, 2);
+    if (!vertices)
+        return;
 
-    glBindVertexArray(ctx.shape_vaos[window_id]);
-    glDrawArrays(GL_LINE_LOOP, 0, 4);
+    set_vertex(&vertices[0], x1, y1, color_rgb);
+    set_vertex(&vertices[1], x2, y2, color_rgb);
 }
 
-void glfw_draw_line(int x1, int y1, int x2, int y2, long unsigned int color, int window_id)
+void glfw_draw_polyline(const float *xs, const float *ys, size_t count, long unsigned int color, float width, int window_id)
 {
+    if (count < 2)
+        return;
 
-    GLFWwindow *target_window = (window_id == 0) ? ctx.window : ctx.child_windows[window_id - 1];
-    glfwMakeContextCurrent(target_window);
-    float ndc_x1, ndc_y1;
-    float ndc_x2, ndc_y2;
     vec3 color_rgb;
+    convert_hex_to_rgb(&color_rgb, color);
+
+    GLenum mode;
+    size_t vertex_count;
+    polyline_geometry(count, width, &mode, &vertex_count);
 
-    convert_coords_to_ndc(target_window, &ndc_x1, &ndc_y1, x1, y1);
-    convert_coords_to_ndc(target_window, &ndc_x2, &ndc_y2, x2, y2);
+    Vertex *vertices = vertex_stream_reserve(&ctx.shape_streams[window_id], mode, vertex_count);
+    if (!vertices)
+        return;
+
+    polyline_build(vertices, xs, ys, count, width, color_rgb);
+}
+
+void glfw_draw_points(const float *xs, const float *ys, size_t count, float size, long unsigned int color, int window_id)
+{
+    if (count == 0)
+        return;
 
+    vec3 color_rgb;
     convert_hex_to_rgb(&color_rgb, color);
 
-    Vertex vertices[2];
+    GLenum mode;
+    size_t vertex_count;
+    points_geometry(count, size, &mode, &vertex_count);
 
-    for (int i = 0; i < 2; i++)
-    {
-        vertices[i].col[0] = color_rgb[0];
-        vertices[i].col[1] = color_rgb[1];
-        vertices[i].col[2] = color_rgb[2];
-    }
+    Vertex *vertices = vertex_stream_reserve(&ctx.shape_streams[window_id], mode, vertex_count);
+    if (!vertices)
+        return;
 
-    vertices[0].pos[0] = ndc_x1;
-    vertices[0].pos[1] = ndc_y1;
-    vertices[1].pos[0] = ndc_x2;
-    vertices[1].pos[1] = ndc_y2;
-    glUseProgram(ctx.shape_program);
+    points_build(vertices, xs, ys, count, size, color_rgb);
+}
 
-    glBindBuffer(GL_ARRAY_BUFFER, ctx.shape_vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
+void glfw_draw_markers(const float *xs, const float *ys, size_t count, const float *sizes, const unsigned char *colors, float size, long unsigned int color, int window_id)
+{
+    if (count == 0)
+        return;
 
-    glBindVertexArray(ctx.shape_vaos[window_id]);
-    glDrawArrays(GL_LINES, 0, 2);
+    vec3 color_rgb;
+    convert_hex_to_rgb(&color_rgb, color);
+
+    glfw_begin_direct_draw(window_id);
+    markers_draw(&ctx.marker_program, ctx.marker_vaos[window_id], ctx.marker_vbo, xs, ys, count, sizes, colors, size, color_rgb,
+                 ctx.viewports[window_id].projection);
+    gl_state_reset(&ctx.gl_states[window_id]);
 }
 
-void glfw_fill_arc(int x_center, int y_center, int width, int height, int angle1, int angle2, int window_id)
+int glfw_create_series(void)
 {
+    return series_pool_acquire(&ctx.series);
+}
 
-    GLFWwindow *target_window = (window_id == 0) ? ctx.window : ctx.child_windows[window_id - 1];
-    glfwMakeContextCurrent(target_window);
-    const int segments = 10;
+bool glfw_upload_series(int series, const float *xs, const float *ys, size_t offset, size_t count, size_t capacity, int window_id)
+{
+    SeriesBuffer *buffer = series_pool_get(&ctx.series, series);
+    if (!buffer)
+        return false;
+
+    glfw_bind_window(window_id);
+    return series_upload(buffer, xs, ys, offset, count, capacity);
+}
 
-    float ndc_x_center, ndc_y_center;
-    convert_coords_to_ndc(target_window, &ndc_x_center, &ndc_y_center, x_center, y_center);
+void glfw_draw_series(int series, size_t first, size_t count, const GooeyPlotTransform *transform, float point_size, long unsigned int color, int window_id)
+{
+    SeriesBuffer *buffer = series_pool_get(&ctx.series, series);
+    if (!buffer)
+        return;
 
     vec3 color_rgb;
-    convert_hex_to_rgb(&color_rgb, ctx.selected_color);
+    convert_hex_to_rgb(&color_rgb, color);
+
+    glfw_begin_direct_draw(window_id);
+    series_draw(&ctx.series_program, ctx.series_vaos[window_id], buffer, first, count, transform, point_size, color_rgb,
+                ctx.viewports[window_id].projection);
+    gl_state_reset(&ctx.gl_states[window_id]);
+}
+
+void glfw_destroy_series(int series)
+{
+    series_pool_release(&ctx.series, series);
+}
+
+int glfw_create_heatmap(void)
+{
+    return heatmap_pool_acquire(&ctx.heatmaps);
+}
+
+bool glfw_upload_heatmap_rows(int heatmap, const float *values, size_t columns, size_t rows, size_t first_row, size_t row_count, int window_id)
+{
+    HeatmapTexture *texture = heatmap_pool_get(&ctx.heatmaps, heatmap);
+    if (!texture)
+        return false;
+
+    glfw_bind_window(window_id);
+    bool uploaded = heatmap_upload_rows(texture, values, columns, rows, first_row, row_count);
+    gl_state_reset(&ctx.gl_states[window_id]);
+    return uploaded;
+}
+
+bool glfw_upload_heatmap_colormap(int heatmap, const unsigned long *colors, size_t count, int window_id)
+{
+    HeatmapTexture *texture = heatmap_pool_get(&ctx.heatmaps, heatmap);
+    if (!texture)
+        return false;
+
+    glfw_bind_window(window_id);
+    bool uploaded = heatmap_upload_colormap(texture, colors, count);
+    gl_state_reset(&ctx.gl_states[window_id]);
+    return uploaded;
+}
+
+void glfw_draw_heatmap(int heatmap, float x, float y, float width, float height, size_t first_row, float min_value, float max_value, int window_id)
+{
+    HeatmapTexture *texture = heatmap_pool_get(&ctx.heatmaps, heatmap);
+    if (!texture)
+        return;
+
+    glfw_begin_direct_draw(window_id);
+    heatmap_draw(&ctx.heatmap_program, ctx.heatmap_vaos[window_id], texture, x, y, width, height, first_row, min_value, max_value,
+                 ctx.viewports[window_id].projection);
+    gl_state_reset(&ctx.gl_states[window_id]);
+}
+
+void glfw_destroy_heatmap(int heatmap)
+{
+    heatmap_pool_release(&ctx.heatmaps, heatmap);
+}
+
+void glfw_fill_arc(int x_center, int y_center, int width, int height, int angle1, int angle2, int window_id)
+{
+    const int segments = 10;
 
-    Vertex vertices[segments + 2];
+    vec3 color_rgb;
+    convert_hex_to_rgb(&color_rgb, ctx.selected_color);
 
-    vertices[0].pos[0] = ndc_x_center;
-    vertices[0].pos[1] = ndc_y_center;
-    vertices[0].col[0] = color_rgb[0];
-    vertices[0].col[1] = color_rgb[1];
-    vertices[0].col[2] = color_rgb[2];
+    float rim[segments + 1][2];
 
     for (int i = 0; i <= segments; ++i)
     {
         float angle = (float)i / segments * 2.0f * M_PI;
-        float x = x_center + (width * 0.5f * cosf(angle));
-        float y = y_center + (height * 0.5f * sinf(angle));
-
-        float ndc_x, ndc_y;
-        convert_coords_to_ndc(window_id == 0 ? ctx.window : ctx.child_windows[window_id - 1], &ndc_x, &ndc_y, x, y);
-
-        vertices[i + 1].pos[0] = ndc_x;
-        vertices[i + 1].pos[1] = ndc_y;
-        vertices[i + 1].col[0] = color_rgb[0];
-        vertices[i + 1].col[1] = color_rgb[1];
-        vertices[i + 1].col[2] = color_rgb[2];
+        rim[i][0] = x_center + (width * 0.5f * cosf(angle));
+        rim[i][1] = y_center + (height * 0.5f * sinf(angle));
     }
 
-    glUseProgram(ctx.shape_program);
-    glBindBuffer(GL_ARRAY_BUFFER, ctx.shape_vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
+    // The fan is unrolled into triangles so consecutive arcs and rectangles share one draw call.
+    Vertex *vertices = vertex_stream_reserve(&ctx.shape_streams[window_id], GL_TRIANGLES, segments * 3);
+    if (!vertices)
+        return;
 
-    glBindVertexArray(ctx.shape_vaos[window_id]);
-    glDrawArrays(GL_TRIANGLE_FAN, 0, segments + 2);
+    for (int i = 0; i < segments; ++i)
+    {
+        set_vertex(&vertices[i * 3], x_center, y_center, color_rgb);
+        set_vertex(&vertices[i * 3 + 1], rim[i][0], rim[i][1], color_rgb);
+        set_vertex(&vertices[i * 3 + 2], rim[i + 1][0], rim[i + 1][1], color_rgb);
+    }
 }
 
 void set_projection(GLFWwindow *window, int width, int height, int window_id)
 {
-    mat4x4 projection;
-    mat4x4_ortho(projection, 0.0f, width, height, 0.0f, -1.0f, 1.0f);
-    glUseProgram(ctx.text_programs[window_id]);
-    glUniformMatrix4fv(glGetUniformLocation(ctx.text_programs[window_id], "projection"), 1, GL_FALSE, (const GLfloat *)projection);
-    glBindVertexArray(ctx.text_vaos[window_id]);
+    WindowViewport *viewport = &ctx.viewports[window_id];
+    set_window_viewport(viewport, width, height);
+    gl_state_use_program(&ctx.gl_states[window_id], ctx.text_programs[window_id]);
+    glUniformMatrix4fv(glGetUniformLocation(ctx.text_programs[window_id], "projection"), 1, GL_FALSE, (const GLfloat *)viewport->projection);
+
+    if (ctx.shape_projection_window == window_id)
+        ctx.shape_projection_window = -1;
 }
 static void error_callback(int error, const char *description)
 {
     LOG_ERROR("Error: %s\n", description);
 }
 
-static void key_callback(GLFWwindow *window, int key, int scancode, int action, int mods)
+/**
+ * @brief Queues an event of the window, every event carries the cursor position it happened at.
+ */
+static void glfw_push_event_at(GLFWwindow *window, GooeyEvent *event, double cursor_x, double cursor_y)
 {
     userPtr *data = glfwGetWindowUserPointer(window);
 
+    event->attached_window = data->id;
+    event->mouse_move.x = cursor_x;
+    event->mouse_move.y = cursor_y;
+    GooeyEventQueue_Push(&ctx.event_queue, event);
+}
+
+/**
+ * @brief Queues an event of the window at the current cursor position.
+ */
+static void glfw_push_event(GLFWwindow *window, GooeyEvent *event)
+{
+    double cursor_x, cursor_y;
+    glfwGetCursorPos(window, &cursor_x, &cursor_y);
+    glfw_push_event_at(window, event, cursor_x, cursor_y);
+}
+
+static void key_callback(GLFWwindow *window, int key, int scancode, int action, int mods)
+{
     if (action == GLFW_PRESS || action == GLFW_RELEASE)
     {
-        
-        if(key == GLFW_KEY_ESCAPE) ctx.current_event->type = GOOEY_EVENT_WINDOW_CLOSE;
-        else {
-            ctx.current_event->type = action == GLFW_PRESS ? GOOEY_EVENT_KEY_PRESS : GOOEY_EVENT_KEY_RELEASE;
-        }
-        ctx.current_event->key_press.keycode = key;
-        ctx.current_event->attached_window = data->id;
+        GooeyEvent event = {0};
+
+        if (key == GLFW_KEY_ESCAPE)
+            event.type = GOOEY_EVENT_WINDOW_CLOSE;
+        else
+            event.type = action == GLFW_PRESS ? GOOEY_EVENT_KEY_PRESS : GOOEY_EVENT_KEY_RELEASE;
+
+        event.key_press.keycode = key;
+        glfw_push_event(window, &event);
     }
 }
 
 static void scroll_callback(GLFWwindow *window, double xoffset, double yoffset)
 {
-    userPtr *data = glfwGetWindowUserPointer(window);
-    ctx.current_event->attached_window = data->id;
-    ctx.current_event->type = GOOEY_EVENT_MOUSE_SCROLL;
-    ctx.current_event->mouse_scroll.x = xoffset;
-    ctx.current_event->mouse_scroll.y = yoffset;
+    GooeyEvent event = {.type = GOOEY_EVENT_MOUSE_SCROLL};
+    event.mouse_scroll.x = xoffset;
+    event.mouse_scroll.y = yoffset;
+    glfw_push_event(window, &event);
 }
 
 static void click_callback(GLFWwindow *window, int button, int action, int mods)
 {
-    userPtr *data = glfwGetWindowUserPointer(window);
-
     if (button == GLFW_MOUSE_BUTTON_LEFT)
     {
-        ctx.current_event->type = action == GLFW_PRESS ? GOOEY_EVENT_CLICK_PRESS : GOOEY_EVENT_CLICK_RELEASE;
-        ctx.current_event->click.x = ctx.current_event->mouse_move.x;
-        ctx.current_event->click.y = ctx.current_event->mouse_move.y;
-        ctx.current_event->attached_window = data->id;
+        GooeyEvent event = {.type = action == GLFW_PRESS ? GOOEY_EVENT_CLICK_PRESS : GOOEY_EVENT_CLICK_RELEASE};
+        double cursor_x, cursor_y;
+        glfwGetCursorPos(window, &cursor_x, &cursor_y);
+        event.click.x = cursor_x;
+        event.click.y = cursor_y;
+        glfw_push_event_at(window, &event, cursor_x, cursor_y);
     }
 }
 
 static void cursor_callback(GLFWwindow *window, double posX, double posY)
 {
-    userPtr *data = glfwGetWindowUserPointer(window);
-    ctx.current_event->attached_window = data->id;
-    ctx.current_event->mouse_move.x = posX;
-    ctx.current_event->mouse_move.y = posY;
+    GooeyEvent event = {.type = GOOEY_EVENT_MOUSE_MOVE};
+    glfw_push_event_at(window, &event, posX, posY);
 }
 
 static void refresh_callback(GLFWwindow *window)
 {
-    ctx.current_event->type = GOOEY_EVENT_EXPOSE;
+    GooeyEvent event = {.type = GOOEY_EVENT_EXPOSE};
+    glfw_push_event(window, &event);
 }
 
 static void framebuffer_size_callback(GLFWwindow *window, int width, int height)
 {
     userPtr *data = glfwGetWindowUserPointer(window);
-    glfwMakeContextCurrent(window);
+    glfw_bind_window(data->id);
     set_projection(window, width, height, data->id);
     glViewport(0, 0, width, height);
-    ctx.current_event->attached_window = data->id;
-    ctx.current_event->type = GOOEY_EVENT_EXPOSE;
+
+    GooeyEvent event = {.type = GOOEY_EVENT_EXPOSE};
+    glfw_push_event(window, &event);
 }
 
 int glfw_init_ft()
@@ -385,7 +577,22 @@ int glfw_init_ft()
 
     FT_Set_Pixel_Sizes(face, 0, 48);
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    // Glyphs are shelf packed row by row into a single atlas, with a 1px gap so linear filtering never bleeds.
+    const int atlas_width = 1024;
+    const int atlas_max_height = 1024;
+    const int padding = 1;
+    unsigned char *atlas_pixels = calloc(atlas_width * atlas_max_height, 1);
+    if (!atlas_pixels)
+    {
+        LOG_ERROR("Failed to allocate glyph atlas\n");
+        FT_Done_Face(face);
+        FT_Done_FreeType(ft);
+        return -1;
+    }
+
+    int glyph_x[128], glyph_y[128];
+    bool loaded[128] = {false};
+    int pen_x = padding, pen_y = padding, shelf_height = 0;
 
     for (unsigned char c = 0; c < 128; c++)
     {
@@ -395,32 +602,65 @@ int glfw_init_ft()
             continue;
         }
 
-        GLuint texture;
-        glGenTextures(1, &texture);
-        glBindTexture(GL_TEXTURE_2D, texture);
-        glTexImage2D(
-            GL_TEXTURE_2D,
-            0,
-            GL_RGBA,
-            face->glyph->bitmap.width,
-            face->glyph->bitmap.rows,
-            0,
-            GL_RED,
-            GL_UNSIGNED_BYTE,
-            face->glyph->bitmap.buffer);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-        Character character = {
-            texture,
-            face->glyph->bitmap.width,
-            face->glyph->bitmap.rows,
-            face->glyph->bitmap_left,
-            face->glyph->bitmap_top,
-            (int)face->glyph->advance.x};
-        ctx.characters[c] = character;
+        FT_Bitmap *bitmap = &face->glyph->bitmap;
+
+        if (pen_x + (int)bitmap->width + padding > atlas_width)
+        {
+            pen_x = padding;
+            pen_y += shelf_height + padding;
+            shelf_height = 0;
+        }
+
+        if (pen_y + (int)bitmap->rows + padding > atlas_max_height)
+        {
+            LOG_ERROR("Glyph atlas is full, skipping character: '%c'\n", c);
+            continue;
+        }
+
+        for (unsigned int row = 0; row < bitmap->rows; ++row)
+        {
+            memcpy(&atlas_pixels[(pen_y + row) * atlas_width + pen_x], &bitmap->buffer[row * bitmap->pitch], bitmap->width);
+        }
+
+        ctx.characters[c] = (Character){
+            .width = bitmap->width,
+            .height = bitmap->rows,
+            .bearingX = face->glyph->bitmap_left,
+            .bearingY = face->glyph->bitmap_top,
+            .advance = (int)face->glyph->advance.x};
+        glyph_x[c] = pen_x;
+        glyph_y[c] = pen_y;
+        loaded[c] = true;
+
+        pen_x += bitmap->width + padding;
+        if ((int)bitmap->rows > shelf_height)
+            shelf_height = bitmap->rows;
+    }
+
+    int atlas_height = pen_y + shelf_height + padding;
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glGenTextures(1, &ctx.glyph_atlas);
+    glBindTexture(GL_TEXTURE_2D, ctx.glyph_atlas);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, atlas_width, atlas_height, 0, GL_RED, GL_UNSIGNED_BYTE, atlas_pixels);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    free(atlas_pixels);
+
+    for (int c = 0; c < 128; c++)
+    {
+        if (!loaded[c])
+            continue;
+
+        Character *character = &ctx.characters[c];
+        character->textureID = ctx.glyph_atlas;
+        character->u0 = (float)glyph_x[c] / atlas_width;
+        character->v0 = (float)glyph_y[c] / atlas_height;
+        character->u1 = (float)(glyph_x[c] + character->width) / atlas_width;
+        character->v1 = (float)(glyph_y[c] + character->height) / atlas_height;
     }
 
     FT_Done_Face(face);
@@ -431,13 +671,24 @@ int glfw_init_ft()
 int glfw_init()
 {
 
-    ctx.inhibit_reset = 0;
+    GooeyEventQueue_Init(&ctx.event_queue);
     ctx.selected_color = 0x000000;
     ctx.window_count = 0;
     ctx.child_windows = (GLFWwindow **)malloc(sizeof(GLFWwindow *) * 100);
     ctx.current_event = (GooeyEvent *)malloc(sizeof(GooeyEvent));
     ctx.text_vaos = (GLuint *)malloc(sizeof(GLuint) * 100);
     ctx.shape_vaos = (GLuint *)malloc(sizeof(GLuint) * 100);
+    ctx.series_vaos = (GLuint *)malloc(sizeof(GLuint) * 100);
+    ctx.marker_vaos = (GLuint *)malloc(sizeof(GLuint) * 100);
+    ctx.heatmap_vaos = (GLuint *)malloc(sizeof(GLuint) * 100);
+    ctx.shape_streams = (VertexStream *)calloc(100, sizeof(VertexStream));
+    ctx.viewports = (WindowViewport *)calloc(100, sizeof(WindowViewport));
+    ctx.gl_states = (GLStateCache *)calloc(100, sizeof(GLStateCache));
+    ctx.render_targets = (RenderTarget *)calloc(100, sizeof(RenderTarget));
+    ctx.clip_rects = (GooeyRect *)calloc(100, sizeof(GooeyRect));
+    ctx.current_window = -1;
+    ctx.shape_projection_window = -1;
+    ctx.swap_interval = 1;
     ctx.user_ptrs = (userPtr *)malloc(sizeof(userPtr) * 100);
     ctx.text_programs = (GLuint *)malloc(sizeof(GLuint) * 100);
     ctx.current_event->type = -1;
@@ -453,16 +704,10 @@ int glfw_init()
     return 0;
 }
 
-void glfw_reset_events(bool state)
-{
-    ctx.inhibit_reset = !state;
-}
 void glfw_window_dim(int *width, int *height, int window_id)
 {
-
-    get_window_size(window_id == 0 ? ctx.window : window_id == 0 ? ctx.window
-                                                                 : ctx.child_windows[window_id - 1],
-                    width, height);
+    *width = ctx.viewports[window_id].width;
+    *height = ctx.viewports[window_id].height;
 }
 
 int glfw_get_current_clicked_window(void)
@@ -472,21 +717,13 @@ int glfw_get_current_clicked_window(void)
 
 void glfw_draw_text(int x, int y, const char *text, unsigned long color, float font_size, int window_id)
 {
-    GLFWwindow *target_window = window_id == 0 ? ctx.window : ctx.child_windows[window_id - 1];
-    glfwMakeContextCurrent(target_window);
     vec3 color_rgb;
-    float ndc_x, ndc_y;
     int window_width, window_height;
 
     glfw_window_dim(&window_width, &window_height, window_id);
     int initial_x = x;
 
-    convert_coords_to_ndc(target_window, &ndc_x, &ndc_y, x, y);
     convert_hex_to_rgb(&color_rgb, color);
-    glUseProgram(ctx.text_programs[window_id]);
-    glUniform3f(glGetUniformLocation(ctx.text_programs[window_id], "textColor"), color_rgb[0], color_rgb[1], color_rgb[2]);
-    glActiveTexture(GL_TEXTURE0);
-    glBindVertexArray(ctx.text_vaos[window_id]);
 
     int line_count = 0;
     int last_space_pos = -1;
@@ -551,24 +788,23 @@ void glfw_draw_text(int x, int y, const char *text, unsigned long color, float f
             break;
         }
 
-        float vertices[6][4] = {
-            {xpos, ypos + h, 0.0f, 0.0f},
-            {xpos, ypos, 0.0f, 1.0f},
-            {xpos + w, ypos, 1.0f, 1.0f},
-            {xpos, ypos + h, 0.0f, 0.0f},
-            {xpos + w, ypos, 1.0f, 1.0f},
-            {xpos + w, ypos + h, 1.0f, 0.0f}};
-
-        glBindTexture(GL_TEXTURE_2D, ch.textureID);
-        glBindBuffer(GL_ARRAY_BUFFER, ctx.text_vbo);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
+        // Blank glyphs such as spaces only advance the pen.
+        if (ch.width > 0 && ch.height > 0)
+        {
+            GlyphVertex *vertices = vertex_stream_reserve_glyphs(&ctx.shape_streams[window_id], 6);
+            if (!vertices)
+                return;
+
+            set_glyph_vertex(&vertices[0], xpos, ypos + h, ch.u0, ch.v1, color_rgb);
+            set_glyph_vertex(&vertices[1], xpos, ypos, ch.u0, ch.v0, color_rgb);
+            set_glyph_vertex(&vertices[2], xpos + w, ypos, ch.u1, ch.v0, color_rgb);
+            set_glyph_vertex(&vertices[3], xpos, ypos + h, ch.u0, ch.v1, color_rgb);
+            set_glyph_vertex(&vertices[4], xpos + w, ypos, ch.u1, ch.v0, color_rgb);
+            set_glyph_vertex(&vertices[5], xpos + w, ypos + h, ch.u1, ch.v1, color_rgb);
+        }
 
         current_x += (ch.advance >> 6) * font_size;
     }
-
-    glBindVertexArray(0);
-    glBindTexture(GL_TEXTURE_2D, 0);
 }
 
 GooeyWindow glfw_create_window(const char *title, int width, int height)
@@ -597,13 +833,13 @@ GooeyWindow glfw_create_window(const char *title, int width, int height)
     glfwSetWindowRefreshCallback(ctx.window, refresh_callback);
     glfwSetFramebufferSizeCallback(ctx.window, framebuffer_size_callback);
     glfwSetScrollCallback(ctx.window, scroll_callback);
-    glfwMakeContextCurrent(ctx.window);
+    glfw_bind_window(window.creation_id);
 
     ctx.user_ptrs[window.creation_id] = (userPtr){.id = window.creation_id};
 
     glfwSetWindowUserPointer(ctx.window, &ctx.user_ptrs[window.creation_id]);
 
-    glfwSwapInterval(1);
+    glfwSwapInterval(ctx.swap_interval);
 
     if (gladLoadGL() == 0)
         exit(EXIT_FAILURE);
@@ -649,7 +885,7 @@ GooeyWindow glfw_spawn_window(const char *title, int width, int height, bool vis
     ctx.child_windows[ctx.window_count] = glfw_window;
     window.creation_id = ctx.window_count + 1;
     ctx.window_count++;
-    glfwMakeContextCurrent(glfw_window);
+    glfw_bind_window(window.creation_id);
     glViewport(0, 0, width, height);
     setup_seperate_vao(window.creation_id);
 
@@ -666,26 +902,44 @@ GooeyWindow glfw_spawn_window(const char *title, int width, int height, bool vis
 
     glfwSetWindowUserPointer(glfw_window, &ctx.user_ptrs[window.creation_id]);
 
-    glfwSwapInterval(1);
+    glfwSwapInterval(ctx.swap_interval);
     return window;
 }
 
-GooeyEvent *glfw_handle_events()
+/**
+ * @brief Processes pending window events without waiting.
+ */
+void glfw_handle_events()
 {
-    if (!ctx.current_event)
-    {
-        LOG_ERROR("Error: HandleEvents called without a valid window\n");
-        return NULL;
-    }
+    glfwPollEvents();
+}
 
-    if (ctx.inhibit_reset)
-    {
-        ctx.current_event->type = -1;
-    }
+/**
+ * @brief Processes pending window events, waiting up to `timeout` seconds for one (forever if negative, not at all if 0).
+ */
+void glfw_wait_events(double timeout)
+{
+    if (timeout == 0.0)
+        glfwPollEvents();
+    else if (timeout < 0.0)
+        glfwWaitEvents();
+    else
+        glfwWaitEventsTimeout(timeout);
+}
 
-    glfwPollEvents();
+bool glfw_pop_event(GooeyEvent *event)
+{
+    if (!GooeyEventQueue_Pop(&ctx.event_queue, event))
+        return false;
+
+    // Kept as the event being handled, for GetCurrentClickedWindow and HideCurrentChild.
+    *ctx.current_event = *event;
+    return true;
+}
 
-    return ctx.current_event;
+void glfw_wake_up(void)
+{
+    glfwPostEmptyEvent();
 }
 
 void glfw_hide_current_child(void)
@@ -699,6 +953,8 @@ void glfw_hide_current_child(void)
 
 void glfw_destroy_windows()
 {
+    ctx.current_window = -1;
+
     if (ctx.window)
     {
         glfwDestroyWindow(ctx.window);
@@ -718,14 +974,66 @@ void glfw_destroy_windows()
     }
 }
 
+/**
+ * @brief Binds the window's offscreen buffer, (re)allocating it when the window size changed.
+ *
+ * Must be called with the window's context current, framebuffers aren't shared between contexts.
+ */
+static void glfw_bind_render_target(int window_id)
+{
+    RenderTarget *target = &ctx.render_targets[window_id];
+    WindowViewport *viewport = &ctx.viewports[window_id];
+
+    if (target->fbo && target->width == viewport->width && target->height == viewport->height)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, target->fbo);
+        return;
+    }
+
+    if (!target->fbo)
+    {
+        glGenFramebuffers(1, &target->fbo);
+        glGenRenderbuffers(1, &target->color_buffer);
+    }
+
+    glBindRenderbuffer(GL_RENDERBUFFER, target->color_buffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, viewport->width, viewport->height);
+    glBindFramebuffer(GL_FRAMEBUFFER, target->fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, target->color_buffer);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        LOG_ERROR("Render target of window %d is incomplete.", window_id);
+
+    target->width = viewport->width;
+    target->height = viewport->height;
+}
+
+void glfw_set_clip_rect(int window_id, int x, int y, int width, int height)
+{
+    ctx.clip_rects[window_id] = (GooeyRect){x, y, width, height};
+}
+
 void glfw_clear(int window_id)
 {
-    glfwMakeContextCurrent(window_id == 0 ? ctx.window : ctx.child_windows[window_id - 1]);
+    glfw_bind_window(window_id);
+    glfw_bind_render_target(window_id);
+
+    // The scissor stays enabled until Render, so it clips both the clear and the flushed stream.
+    GooeyRect *clip = &ctx.clip_rects[window_id];
+    if (clip->width > 0 && clip->height > 0)
+    {
+        glEnable(GL_SCISSOR_TEST);
+        glScissor(clip->x, ctx.viewports[window_id].height - clip->y - clip->height, clip->width, clip->height);
+    }
+    else
+    {
+        glDisable(GL_SCISSOR_TEST);
+    }
 
-    glClear(GL_COLOR_BUFFER_BIT);
     vec3 color;
     convert_hex_to_rgb(&color, active_theme->base);
     glClearColor(color[0], color[1], color[2], 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 }
@@ -738,10 +1046,13 @@ void glfw_cleanup()
         ctx.current_event = NULL;
     }
 
-    if (ctx.cursor)
+    for (int i = 0; i <= GOOEY_CURSOR_NOT_ALLOWED; ++i)
     {
-        glfwDestroyCursor(ctx.cursor);
-        ctx.cursor = NULL;
+        if (ctx.cursors[i])
+        {
+            glfwDestroyCursor(ctx.cursors[i]);
+            ctx.cursors[i] = NULL;
+        }
     }
 
     if (ctx.text_vaos)
@@ -756,6 +1067,65 @@ void glfw_cleanup()
         ctx.shape_vaos = NULL;
     }
 
+    if (ctx.series_vaos)
+    {
+        free(ctx.series_vaos);
+        ctx.series_vaos = NULL;
+    }
+
+    if (ctx.marker_vaos)
+    {
+        free(ctx.marker_vaos);
+        ctx.marker_vaos = NULL;
+    }
+
+    if (ctx.heatmap_vaos)
+    {
+        free(ctx.heatmap_vaos);
+        ctx.heatmap_vaos = NULL;
+    }
+
+    // Windows are already destroyed here, the series' buffers went away with the contexts.
+    free(ctx.series.items);
+    ctx.series = (SeriesPool){0};
+    free(ctx.heatmaps.items);
+    ctx.heatmaps = (HeatmapPool){0};
+
+    if (ctx.shape_streams)
+    {
+        for (int i = 0; i <= ctx.window_count; ++i)
+        {
+            vertex_stream_free(&ctx.shape_streams[i]);
+        }
+        free(ctx.shape_streams);
+        ctx.shape_streams = NULL;
+    }
+
+    if (ctx.viewports)
+    {
+        free(ctx.viewports);
+        ctx.viewports = NULL;
+    }
+
+    if (ctx.gl_states)
+    {
+        free(ctx.gl_states);
+        ctx.gl_states = NULL;
+    }
+
+    if (ctx.render_targets)
+    {
+        // Windows are already destroyed here, their GL objects went away with the contexts.
+        free(ctx.render_targets);
+        ctx.render_targets = NULL;
+    }
+
+    if (ctx.clip_rects)
+    {
+        free(ctx.clip_rects);
+        ctx.clip_rects = NULL;
+    }
+
     if (ctx.user_ptrs)
     {
         free(ctx.user_ptrs);
@@ -770,6 +1140,7 @@ void glfw_cleanup()
 
     glDeleteShader(ctx.text_vertex_shader);
     glDeleteShader(ctx.text_fragment_shader);
+    glDeleteTextures(1, &ctx.glyph_atlas);
 
     glfwTerminate();
 }
@@ -777,9 +1148,9 @@ void glfw_cleanup()
 void glfw_update_background()
 {
 
-    for (int i = 0; i < ctx.window_count; ++i)
+    for (int i = 0; i <= ctx.window_count; ++i)
     {
-        glfwMakeContextCurrent(i == 0 ? ctx.window : ctx.child_windows[i - 1]);
+        glfw_bind_window(i);
 
         vec3 color;
         convert_hex_to_rgb(&color, active_theme->base);
@@ -797,6 +1168,18 @@ void glfw_render(int window_id)
         return;
     }
 
+    glfw_bind_window(window_id);
+    glfw_flush_stream(window_id);
+
+    RenderTarget *target = &ctx.render_targets[window_id];
+    if (target->fbo)
+    {
+        glDisable(GL_SCISSOR_TEST);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, target->fbo);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+        glBlitFramebuffer(0, 0, target->width, target->height, 0, 0, target->width, target->height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    }
+
     glfwSwapBuffers(context);
 }
 
@@ -833,62 +1216,60 @@ const char *glfw_get_key_from_code(GooeyEvent *gooey_event)
 
 void glfw_set_cursor(GOOEY_CURSOR cursor)
 {
-    switch (cursor)
-    {
-
-    case GOOEY_CURSOR_ARROW:
-        ctx.cursor = glfwCreateStandardCursor(GLFW_ARROW_CURSOR);
-        glfwSetCursor(ctx.window, ctx.cursor);
-        break;
-
-    case GOOEY_CURSOR_HAND:
-        ctx.cursor = glfwCreateStandardCursor(GLFW_HAND_CURSOR);
-        glfwSetCursor(ctx.window, ctx.cursor);
-        break;
-    case GOOEY_CURSOR_TEXT:
-        ctx.cursor = glfwCreateStandardCursor(GLFW_IBEAM_CURSOR);
-        glfwSetCursor(ctx.window, ctx.cursor);
-        break;
-    case GOOEY_CURSOR_CROSSHAIR:
-        ctx.cursor = glfwCreateStandardCursor(GLFW_CROSSHAIR_CURSOR);
-        glfwSetCursor(ctx.window, ctx.cursor);
-        break;
-    case GOOEY_CURSOR_RESIZE_TL_BR:
-        ctx.cursor = glfwCreateStandardCursor(GLFW_RESIZE_NWSE_CURSOR);
-        glfwSetCursor(ctx.window, ctx.cursor);
-        break;
-    case GOOEY_CURSOR_RESIZE_TR_BL:
-        ctx.cursor = glfwCreateStandardCursor(GLFW_RESIZE_NESW_CURSOR);
-        glfwSetCursor(ctx.window, ctx.cursor);
-        break;
-
-    case GOOEY_CURSOR_RESIZE_H:
-        ctx.cursor = glfwCreateStandardCursor(GLFW_RESIZE_EW_CURSOR);
-        glfwSetCursor(ctx.window, ctx.cursor);
-        break;
-
-    case GOOEY_CURSOR_RESIZE_V:
-        ctx.cursor = glfwCreateStandardCursor(GLFW_RESIZE_NS_CURSOR);
-        glfwSetCursor(ctx.window, ctx.cursor);
-        break;
-
-    case GOOEY_CURSOR_RESIZE_ALL:
-        ctx.cursor = glfwCreateStandardCursor(GLFW_RESIZE_ALL_CURSOR);
-        glfwSetCursor(ctx.window, ctx.cursor);
-        break;
-
-    case GOOEY_CURSOR_NOT_ALLOWED:
-        ctx.cursor = glfwCreateStandardCursor(GLFW_NOT_ALLOWED_CURSOR);
-        glfwSetCursor(ctx.window, ctx.cursor);
-        break;
-    default:
-        break;
+    static const int shapes[GOOEY_CURSOR_NOT_ALLOWED + 1] = {
+        [GOOEY_CURSOR_ARROW] = GLFW_ARROW_CURSOR,
+        [GOOEY_CURSOR_TEXT] = GLFW_IBEAM_CURSOR,
+        [GOOEY_CURSOR_CROSSHAIR] = GLFW_CROSSHAIR_CURSOR,
+        [GOOEY_CURSOR_HAND] = GLFW_HAND_CURSOR,
+        [GOOEY_CURSOR_RESIZE_H] = GLFW_RESIZE_EW_CURSOR,
+        [GOOEY_CURSOR_RESIZE_V] = GLFW_RESIZE_NS_CURSOR,
+        [GOOEY_CURSOR_RESIZE_TL_BR] = GLFW_RESIZE_NWSE_CURSOR,
+        [GOOEY_CURSOR_RESIZE_TR_BL] = GLFW_RESIZE_NESW_CURSOR,
+        [GOOEY_CURSOR_RESIZE_ALL] = GLFW_RESIZE_ALL_CURSOR,
+        [GOOEY_CURSOR_NOT_ALLOWED] = GLFW_NOT_ALLOWED_CURSOR};
+
+    if (cursor < GOOEY_CURSOR_ARROW || cursor > GOOEY_CURSOR_NOT_ALLOWED)
+        return;
+
+    // Standard cursors are created once and reused, they are destroyed in cleanup.
+    if (!ctx.cursors[cursor])
+        ctx.cursors[cursor] = glfwCreateStandardCursor(shapes[cursor]);
+
+    // Applied to the window of the event being handled, which is where the pointer is.
+    int window_id = ctx.current_event->attached_window;
+    GLFWwindow *window = window_id > 0 ? ctx.child_windows[window_id - 1] : ctx.window;
+    if (window)
+        glfwSetCursor(window, ctx.cursors[cursor]);
+}
+
+void glfw_set_swap_interval(int interval)
+{
+    ctx.swap_interval = interval;
+
+    // The swap interval belongs to the context, so each window needs its own call.
+    if (ctx.window)
+    {
+        glfw_bind_window(0);
+        glfwSwapInterval(interval);
+    }
+
+    for (int i = 0; i < ctx.window_count; ++i)
+    {
+        if (!ctx.child_windows[i])
+            continue;
+
+        glfw_bind_window(i + 1);
+        glfwSwapInterval(interval);
     }
 }
 
 void glfw_destroy_window_from_id(int window_id)
 {
+    if (ctx.current_window == window_id + 1)
+        ctx.current_window = -1;
+
     glfwDestroyWindow(ctx.child_windows[window_id]);
+    ctx.child_windows[window_id] = NULL;
 }
 
 GooeyBackend glfw_backend = {
@@ -906,15 +1287,31 @@ GooeyBackend glfw_backend = {
     .Cleanup = glfw_cleanup,
     .Render = glfw_render,
     .HandleEvents = glfw_handle_events,
-    .InhibitResetEvents = glfw_reset_events,
+    .WaitEvents = glfw_wait_events,
+    .WakeUp = glfw_wake_up,
+    .PopEvent = glfw_pop_event,
     .FillArc = glfw_fill_arc,
     .FillRectangle = glfw_fill_rectangle,
     .DrawRectangle = glfw_draw_rectangle,
     .DrawLine = glfw_draw_line,
+    .DrawPolyline = glfw_draw_polyline,
+    .DrawPoints = glfw_draw_points,
+    .DrawMarkers = glfw_draw_markers,
+    .CreateSeries = glfw_create_series,
+    .UploadSeries = glfw_upload_series,
+    .DrawSeries = glfw_draw_series,
+    .DestroySeries = glfw_destroy_series,
+    .CreateHeatmap = glfw_create_heatmap,
+    .UploadHeatmapRows = glfw_upload_heatmap_rows,
+    .UploadHeatmapColormap = glfw_upload_heatmap_colormap,
+    .DrawHeatmap = glfw_draw_heatmap,
+    .DestroyHeatmap = glfw_destroy_heatmap,
     .SetForeground = glfw_set_foreground,
     .GetTextWidth = glfw_get_text_width,
     .GetTextHeight = glfw_get_text_height,
     .DrawText = glfw_draw_text,
     .GetKeyFromCode = glfw_get_key_from_code,
     .SetCursor = glfw_set_cursor,
+    .SetClipRect = glfw_set_clip_rect,
+    .SetSwapInterval = glfw_set_swap_interval,
     .Clear = glfw_clear};
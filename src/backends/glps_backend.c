@@ -15,6 +15,7 @@
  along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 #include "utils/backends/backend_utils.h"
+#include "core/gooey_event_queue.h"
 
 typedef struct
 {
@@ -26,6 +27,17 @@ typedef struct
     GLuint shape_vbo;
     GLuint *text_vaos;
     GLuint *shape_vaos;
+    GLuint *series_vaos;       /**< Per-window vertex array plot series are drawn with. */
+    SeriesProgram series_program;
+    SeriesPool series;         /**< GPU resident plot series, shared by every window. */
+    GLuint marker_vbo;         /**< Per-marker values of the markers being drawn, shared by every window. */
+    GLuint *marker_vaos;       /**< Per-window vertex array markers are drawn with. */
+    MarkerProgram marker_program;
+    GLuint *heatmap_vaos;      /**< Per-window attribute-less vertex array heatmaps are drawn with. */
+    HeatmapProgram heatmap_program;
+    HeatmapPool heatmaps;      /**< Float textures of heatmap plots, shared by every window. */
+    WindowViewport *viewports; /**< Per-window framebuffer size, refreshed on resize only. */
+    GLint shape_projection_location;
     mat4x4 projection;
     GLuint text_fragment_shader;
     glps_WindowManager *wm;
@@ -33,7 +45,8 @@ typedef struct
     Character characters[128];
     char font_path[256];
     int window_count;
-    bool inhibit_reset; /**< useful for continuesly happening events like dragging a slider. */
+    GooeyEventQueue event_queue; /**< Events queued by the callbacks until the run loop pops them. */
+    GooeyMouseData cursor;       /**< Last cursor position reported by the window manager. */
     unsigned int selected_color;
 } GooeyBackendContext;
 ;
@@ -72,6 +85,12 @@ void glps_setup_shared()
     glAttachShader(ctx.shape_program, shape_fragment_shader);
     glLinkProgram(ctx.shape_program);
     check_shader_link(ctx.shape_program);
+    ctx.shape_projection_location = glGetUniformLocation(ctx.shape_program, "projection");
+
+    series_program_init(&ctx.series_program);
+    marker_program_init(&ctx.marker_program);
+    glGenBuffers(1, &ctx.marker_vbo);
+    heatmap_program_init(&ctx.heatmap_program);
 
     glDeleteShader(shape_vertex_shader);
     glDeleteShader(shape_fragment_shader);
@@ -111,18 +130,18 @@ void glps_setup_seperate_vao(int window_id)
     glEnableVertexAttribArray(col_attrib);
     glVertexAttribPointer(col_attrib, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, col));
     ctx.shape_vaos[window_id] = shape_vao;
+
+    glGenVertexArrays(1, &ctx.series_vaos[window_id]);
+    glGenVertexArrays(1, &ctx.marker_vaos[window_id]);
+    glGenVertexArrays(1, &ctx.heatmap_vaos[window_id]);
 }
 
 void glps_fill_rectangle(int x, int y, int width, int height, long unsigned int color, int window_id)
 {
 
     glps_wm_set_window_ctx_curr(ctx.wm, window_id);
-    float ndc_x, ndc_y;
-    float ndc_width, ndc_height;
     vec3 color_rgb;
 
-    convert_coords_to_ndc(window_id, &ndc_x, &ndc_y, x, y);
-    convert_dimension_to_ndc(window_id, &ndc_width, &ndc_height, width, height);
     convert_hex_to_rgb(&color_rgb, color);
 
     Vertex vertices[6];
@@ -134,19 +153,19 @@ void glps_fill_rectangle(int x, int y, int width, int height, long unsigned int
         vertices[i].col[2] = color_rgb[2];
     }
 
-    vertices[0].pos[0] = ndc_x;
-    vertices[0].pos[1] = ndc_y;
-    vertices[1].pos[0] = ndc_x + ndc_width;
-    vertices[1].pos[1] = ndc_y;
-    vertices[2].pos[0] = ndc_x;
-    vertices[2].pos[1] = ndc_y + ndc_height;
+    vertices[0].pos[0] = x;
+    vertices[0].pos[1] = y;
+    vertices[1].pos[0] = x + width;
+    vertices[1].pos[1] = y;
+    vertices[2].pos[0] = x;
+    vertices[2].pos[1] = y + height;
 
-    vertices[3].pos[0] = ndc_x + ndc_width;
-    vertices[3].pos[1] = ndc_y;
-    vertices[4].pos[0] = ndc_x + ndc_width;
-    vertices[4].pos[1] = ndc_y + ndc_height;
-    vertices[5].pos[0] = ndc_x;
-    vertices[5].pos[1] = ndc_y + ndc_height;
+    vertices[3].pos[0] = x + width;
+    vertices[3].pos[1] = y;
+    vertices[4].pos[0] = x + width;
+    vertices[4].pos[1] = y + height;
+    vertices[5].pos[0] = x;
+    vertices[5].pos[1] = y + height;
 
     glUseProgram(ctx.shape_program);
 
@@ -164,12 +183,8 @@ void glps_set_foreground(long unsigned int color)
 void glps_draw_rectangle(int x, int y, int width, int height, long unsigned int color, int window_id)
 {
     glps_wm_set_window_ctx_curr(ctx.wm, window_id);
-    float ndc_x, ndc_y;
-    float ndc_width, ndc_height;
     vec3 color_rgb;
 
-    convert_coords_to_ndc(window_id, &ndc_x, &ndc_y, x, y);
-    convert_dimension_to_ndc(window_id, &ndc_width, &ndc_height, width, height);
     convert_hex_to_rgb(&color_rgb, color);
 
     Vertex vertices[4];
@@ -181,15 +196,15 @@ void glps_draw_rectangle(int x, int y, int width, int height, long unsigned int
         vertices[i].col[2] = color_rgb[2];
     }
 
-    vertices[0].pos[0] = ndc_x;
-    vertices[0].pos[1] = ndc_y;
-    vertices[1].pos[0] = ndc_x + ndc_width;
-    vertices[1].pos[1] = ndc_y;
-    vertices[2].pos[0] = ndc_x + ndc_width;
-    vertices[2].pos[1] = ndc_y + ndc_height;
+    vertices[0].pos[0] = x;
+    vertices[0].pos[1] = y;
+    vertices[1].pos[0] = x + width;
+    vertices[1].pos[1] = y;
+    vertices[2].pos[0] = x + width;
+    vertices[2].pos[1] = y + height;
 
-    vertices[3].pos[0] = ndc_x;
-    vertices[3].pos[1] = ndc_y + ndc_height;
+    vertices[3].pos[0] = x;
+    vertices[3].pos[1] = y + height;
     glUseProgram(ctx.shape_program);
 
     glBindBuffer(GL_ARRAY_BUFFER, ctx.shape_vbo);
@@ -203,13 +218,8 @@ void glps_draw_line(int x1, int y1, int x2, int y2, long unsigned int color, int
 {
 
     glps_wm_set_window_ctx_curr(ctx.wm, window_id);
-    float ndc_x1, ndc_y1;
-    float ndc_x2, ndc_y2;
     vec3 color_rgb;
 
-    convert_coords_to_ndc(window_id, &ndc_x1, &ndc_y1, x1, y1);
-    convert_coords_to_ndc(window_id, &ndc_x2, &ndc_y2, x2, y2);
-
     convert_hex_to_rgb(&color_rgb, color);
 
     Vertex vertices[2];
@@ -221,10 +231,10 @@ void glps_draw_line(int x1, int y1, int x2, int y2, long unsigned int color, int
         vertices[i].col[2] = color_rgb[2];
     }
 
-    vertices[0].pos[0] = ndc_x1;
-    vertices[0].pos[1] = ndc_y1;
-    vertices[1].pos[0] = ndc_x2;
-    vertices[1].pos[1] = ndc_y2;
+    vertices[0].pos[0] = x1;
+    vertices[0].pos[1] = y1;
+    vertices[1].pos[0] = x2;
+    vertices[1].pos[1] = y2;
     glUseProgram(ctx.shape_program);
 
     glBindBuffer(GL_ARRAY_BUFFER, ctx.shape_vbo);
@@ -234,22 +244,171 @@ void glps_draw_line(int x1, int y1, int x2, int y2, long unsigned int color, int
     glDrawArrays(GL_LINES, 0, 2);
 }
 
+/**
+ * @brief Uploads and draws a batch of shape vertices built by one of the backend_utils geometry builders.
+ */
+static void glps_draw_shape_batch(Vertex *vertices, size_t vertex_count, GLenum mode, int window_id)
+{
+    glUseProgram(ctx.shape_program);
+
+    glBindBuffer(GL_ARRAY_BUFFER, ctx.shape_vbo);
+    glBufferData(GL_ARRAY_BUFFER, vertex_count * sizeof(Vertex), vertices, GL_DYNAMIC_DRAW);
+
+    glBindVertexArray(ctx.shape_vaos[window_id]);
+    glDrawArrays(mode, 0, vertex_count);
+}
+
+void glps_draw_polyline(const float *xs, const float *ys, size_t count, long unsigned int color, float width, int window_id)
+{
+    if (count < 2)
+        return;
+
+    glps_wm_set_window_ctx_curr(ctx.wm, window_id);
+    vec3 color_rgb;
+    convert_hex_to_rgb(&color_rgb, color);
+
+    GLenum mode;
+    size_t vertex_count;
+    polyline_geometry(count, width, &mode, &vertex_count);
+
+    Vertex *vertices = malloc(vertex_count * sizeof(Vertex));
+    if (!vertices)
+    {
+        LOG_ERROR("Failed to allocate polyline vertices.");
+        return;
+    }
+
+    polyline_build(vertices, xs, ys, count, width, color_rgb);
+    glps_draw_shape_batch(vertices, vertex_count, mode, window_id);
+    free(vertices);
+}
+
+void glps_draw_points(const float *xs, const float *ys, size_t count, float size, long unsigned int color, int window_id)
+{
+    if (count == 0)
+        return;
+
+    glps_wm_set_window_ctx_curr(ctx.wm, window_id);
+    vec3 color_rgb;
+    convert_hex_to_rgb(&color_rgb, color);
+
+    GLenum mode;
+    size_t vertex_count;
+    points_geometry(count, size, &mode, &vertex_count);
+
+    Vertex *vertices = malloc(vertex_count * sizeof(Vertex));
+    if (!vertices)
+    {
+        LOG_ERROR("Failed to allocate point vertices.");
+        return;
+    }
+
+    points_build(vertices, xs, ys, count, size, color_rgb);
+    glps_draw_shape_batch(vertices, vertex_count, mode, window_id);
+    free(vertices);
+}
+
+void glps_draw_markers(const float *xs, const float *ys, size_t count, const float *sizes, const unsigned char *colors, float size, long unsigned int color, int window_id)
+{
+    if (count == 0)
+        return;
+
+    glps_wm_set_window_ctx_curr(ctx.wm, window_id);
+    vec3 color_rgb;
+    convert_hex_to_rgb(&color_rgb, color);
+
+    markers_draw(&ctx.marker_program, ctx.marker_vaos[window_id], ctx.marker_vbo, xs, ys, count, sizes, colors, size, color_rgb,
+                 ctx.viewports[window_id].projection);
+}
+
+int glps_create_series(void)
+{
+    return series_pool_acquire(&ctx.series);
+}
+
+bool glps_upload_series(int series, const float *xs, const float *ys, size_t offset, size_t count, size_t capacity, int window_id)
+{
+    SeriesBuffer *buffer = series_pool_get(&ctx.series, series);
+    if (!buffer)
+        return false;
+
+    glps_wm_set_window_ctx_curr(ctx.wm, window_id);
+    return series_upload(buffer, xs, ys, offset, count, capacity);
+}
+
+void glps_draw_series(int series, size_t first, size_t count, const GooeyPlotTransform *transform, float point_size, long unsigned int color, int window_id)
+{
+    SeriesBuffer *buffer = series_pool_get(&ctx.series, series);
+    if (!buffer)
+        return;
+
+    glps_wm_set_window_ctx_curr(ctx.wm, window_id);
+    vec3 color_rgb;
+    convert_hex_to_rgb(&color_rgb, color);
+
+    series_draw(&ctx.series_program, ctx.series_vaos[window_id], buffer, first, count, transform, point_size, color_rgb,
+                ctx.viewports[window_id].projection);
+}
+
+void glps_destroy_series(int series)
+{
+    series_pool_release(&ctx.series, series);
+}
+
+int glps_create_heatmap(void)
+{
+    return heatmap_pool_acquire(&ctx.heatmaps);
+}
+
+bool glps_upload_heatmap_rows(int heatmap, const float *values, size_t columns, size_t rows, size_t first_row, size_t row_count, int window_id)
+{
+    HeatmapTexture *texture = heatmap_pool_get(&ctx.heatmaps, heatmap);
+    if (!texture)
+        return false;
+
+    glps_wm_set_window_ctx_curr(ctx.wm, window_id);
+    return heatmap_upload_rows(texture, values, columns, rows, first_row, row_count);
+}
+
+bool glps_upload_heatmap_colormap(int heatmap, const unsigned long *colors, size_t count, int window_id)
+{
+    HeatmapTexture *texture = heatmap_pool_get(&ctx.heatmaps, heatmap);
+    if (!texture)
+        return false;
+
+    glps_wm_set_window_ctx_curr(ctx.wm, window_id);
+    return heatmap_upload_colormap(texture, colors, count);
+}
+
+void glps_draw_heatmap(int heatmap, float x, float y, float width, float height, size_t first_row, float min_value, float max_value, int window_id)
+{
+    HeatmapTexture *texture = heatmap_pool_get(&ctx.heatmaps, heatmap);
+    if (!texture)
+        return;
+
+    glps_wm_set_window_ctx_curr(ctx.wm, window_id);
+    heatmap_draw(&ctx.heatmap_program, ctx.heatmap_vaos[window_id], texture, x, y, width, height, first_row, min_value, max_value,
+                 ctx.viewports[window_id].projection);
+}
+
+void glps_destroy_heatmap(int heatmap)
+{
+    heatmap_pool_release(&ctx.heatmaps, heatmap);
+}
+
 void glps_fill_arc(int x_center, int y_center, int width, int height, int angle1, int angle2, int window_id)
 {
 
     glps_wm_set_window_ctx_curr(ctx.wm, window_id);
     const int segments = 10;
 
-    float ndc_x_center, ndc_y_center;
-    convert_coords_to_ndc(window_id, &ndc_x_center, &ndc_y_center, x_center, y_center);
-
     vec3 color_rgb;
     convert_hex_to_rgb(&color_rgb, ctx.selected_color);
 
     Vertex vertices[segments + 2];
 
-    vertices[0].pos[0] = ndc_x_center;
-    vertices[0].pos[1] = ndc_y_center;
+    vertices[0].pos[0] = x_center;
+    vertices[0].pos[1] = y_center;
     vertices[0].col[0] = color_rgb[0];
     vertices[0].col[1] = color_rgb[1];
     vertices[0].col[2] = color_rgb[2];
@@ -260,11 +419,8 @@ void glps_fill_arc(int x_center, int y_center, int width, int height, int angle1
         float x = x_center + (width * 0.5f * cosf(angle));
         float y = y_center + (height * 0.5f * sinf(angle));
 
-        float ndc_x, ndc_y;
-        convert_coords_to_ndc(window_id, &ndc_x, &ndc_y, x, y);
-
-        vertices[i + 1].pos[0] = ndc_x;
-        vertices[i + 1].pos[1] = ndc_y;
+        vertices[i + 1].pos[0] = x;
+        vertices[i + 1].pos[1] = y;
         vertices[i + 1].col[0] = color_rgb[0];
         vertices[i + 1].col[1] = color_rgb[1];
         vertices[i + 1].col[2] = color_rgb[2];
@@ -280,10 +436,12 @@ void glps_fill_arc(int x_center, int y_center, int width, int height, int angle1
 
 void glps_set_projection(int width, int height, int window_id)
 {
-    mat4x4 projection;
-    mat4x4_ortho(projection, 0.0f, width, height, 0.0f, -1.0f, 1.0f);
+    WindowViewport *viewport = &ctx.viewports[window_id];
+    set_window_viewport(viewport, width, height);
+    glUseProgram(ctx.shape_program);
+    glUniformMatrix4fv(ctx.shape_projection_location, 1, GL_FALSE, (const GLfloat *)viewport->projection);
     glUseProgram(ctx.text_programs[window_id]);
-    glUniformMatrix4fv(glGetUniformLocation(ctx.text_programs[window_id], "projection"), 1, GL_FALSE, (const GLfloat *)projection);
+    glUniformMatrix4fv(glGetUniformLocation(ctx.text_programs[window_id], "projection"), 1, GL_FALSE, (const GLfloat *)viewport->projection);
     glBindVertexArray(ctx.text_vaos[window_id]);
 }
 static void error_callback(int error, const char *description)
@@ -291,51 +449,61 @@ static void error_callback(int error, const char *description)
     LOG_ERROR("Error: %s\n", description);
 }
 
+/**
+ * @brief Queues an event of the window, every event carries the last known cursor position.
+ */
+static void glps_push_event(size_t window_id, GooeyEvent *event)
+{
+    event->attached_window = window_id;
+    event->mouse_move = ctx.cursor;
+    GooeyEventQueue_Push(&ctx.event_queue, event);
+}
+
 static void keyboard_callback(size_t window_id, bool state, const char *value,
                               void *data)
 {
-
-    ctx.current_event->type = state ? GOOEY_EVENT_KEY_PRESS : GOOEY_EVENT_KEY_RELEASE;
-    ctx.current_event->key_press.keycode = state;
-    ctx.current_event->attached_window = window_id;
+    GooeyEvent event = {.type = state ? GOOEY_EVENT_KEY_PRESS : GOOEY_EVENT_KEY_RELEASE};
+    event.key_press.keycode = state;
+    glps_push_event(window_id, &event);
 }
 
 static void mouse_scroll_callback(size_t window_id, GLPS_SCROLL_AXES axe,
                                   GLPS_SCROLL_SOURCE source, double value,
                                   int discrete, bool is_stopped, void *data)
 {
-    ctx.current_event->attached_window = window_id;
-    ctx.current_event->type = GOOEY_EVENT_MOUSE_SCROLL;
+    GooeyEvent event = {.type = GOOEY_EVENT_MOUSE_SCROLL};
     if (axe == GLPS_SCROLL_H_AXIS)
-        ctx.current_event->mouse_scroll.x = value;
+        event.mouse_scroll.x = value;
     else
-        ctx.current_event->mouse_scroll.y = value;
+        event.mouse_scroll.y = value;
+    glps_push_event(window_id, &event);
 }
 
 void mouse_click_callback(size_t window_id, bool state, void *data)
 {
-
-    ctx.current_event->type = state ? GOOEY_EVENT_CLICK_PRESS : GOOEY_EVENT_CLICK_RELEASE;
-    ctx.current_event->click.x = ctx.current_event->mouse_move.x;
-    ctx.current_event->click.y = ctx.current_event->mouse_move.y;
-    ctx.current_event->attached_window = window_id;
+    GooeyEvent event = {.type = state ? GOOEY_EVENT_CLICK_PRESS : GOOEY_EVENT_CLICK_RELEASE};
+    event.click = ctx.cursor;
+    glps_push_event(window_id, &event);
 }
 
 static void mouse_move_callback(size_t window_id, double posX, double posY)
 {
-    ctx.current_event->attached_window = window_id;
-    ctx.current_event->mouse_move.x = posX;
-    ctx.current_event->mouse_move.y = posY;
+    ctx.cursor.x = posX;
+    ctx.cursor.y = posY;
+
+    GooeyEvent event = {.type = GOOEY_EVENT_MOUSE_MOVE};
+    glps_push_event(window_id, &event);
 }
 
 void window_resize_callback(size_t window_id, int width, int height,
                             void *data)
 {
     glps_wm_set_window_ctx_curr(ctx.wm, window_id);
-    glps_set_projection(window_id, width, height);
+    glps_set_projection(width, height, window_id);
     glViewport(0, 0, width, height);
-    ctx.current_event->attached_window = window_id;
-    ctx.current_event->type = GOOEY_EVENT_EXPOSE;
+
+    GooeyEvent event = {.type = GOOEY_EVENT_EXPOSE};
+    glps_push_event(window_id, &event);
 }
 
 int glps_init_ft()
@@ -388,12 +556,12 @@ int glps_init_ft()
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
         Character character = {
-            texture,
-            face->glyph->bitmap.width,
-            face->glyph->bitmap.rows,
-            face->glyph->bitmap_left,
-            face->glyph->bitmap_top,
-            (int)face->glyph->advance.x};
+            .textureID = texture,
+            .width = face->glyph->bitmap.width,
+            .height = face->glyph->bitmap.rows,
+            .bearingX = face->glyph->bitmap_left,
+            .bearingY = face->glyph->bitmap_top,
+            .advance = (int)face->glyph->advance.x};
         ctx.characters[c] = character;
     }
 
@@ -405,12 +573,16 @@ int glps_init_ft()
 int glps_init()
 {
 
-    ctx.inhibit_reset = 0;
+    GooeyEventQueue_Init(&ctx.event_queue);
     ctx.selected_color = 0x000000;
     ctx.window_count = 0;
     ctx.current_event = (GooeyEvent *)malloc(sizeof(GooeyEvent));
     ctx.text_vaos = (GLuint *)malloc(sizeof(GLuint) * 100);
     ctx.shape_vaos = (GLuint *)malloc(sizeof(GLuint) * 100);
+    ctx.series_vaos = (GLuint *)malloc(sizeof(GLuint) * 100);
+    ctx.marker_vaos = (GLuint *)malloc(sizeof(GLuint) * 100);
+    ctx.heatmap_vaos = (GLuint *)malloc(sizeof(GLuint) * 100);
+    ctx.viewports = (WindowViewport *)calloc(100, sizeof(WindowViewport));
     ctx.text_programs = (GLuint *)malloc(sizeof(GLuint) * 100);
     ctx.current_event->type = -1;
     ctx.current_event->attached_window = -1;
@@ -421,15 +593,10 @@ int glps_init()
     return 0;
 }
 
-void glps_reset_events(bool state)
-{
-    ctx.inhibit_reset = !state;
-}
 void glps_window_dim(int *width, int *height, int window_id)
 {
-
-    get_window_size(window_id,
-                    width, height);
+    *width = ctx.viewports[window_id].width;
+    *height = ctx.viewports[window_id].height;
 }
 
 int glps_get_current_clicked_window(void)
@@ -441,13 +608,11 @@ void glps_draw_text(int x, int y, const char *text, unsigned long color, float f
 {
     glps_wm_set_window_ctx_curr(ctx.wm, window_id);
     vec3 color_rgb;
-    float ndc_x, ndc_y;
     int window_width, window_height;
 
     glps_window_dim(&window_width, &window_height, window_id);
     int initial_x = x;
 
-    convert_coords_to_ndc(window_id, &ndc_x, &ndc_y, x, y);
     convert_hex_to_rgb(&color_rgb, color);
     glUseProgram(ctx.text_programs[window_id]);
     glUniform3f(glGetUniformLocation(ctx.text_programs[window_id], "textColor"), color_rgb[0], color_rgb[1], color_rgb[2]);
@@ -626,23 +791,21 @@ GooeyWindow glps_spawn_window(const char *title, int width, int height, bool vis
     */
 }
 
-GooeyEvent *glps_handle_events()
+void glps_handle_events()
 {
-    if (!ctx.current_event)
-    {
-        LOG_ERROR("Error: HandleEvents called without a valid window\n");
-        return NULL;
-    }
-
-    if (ctx.inhibit_reset)
-    {
-        ctx.current_event->type = -1;
-    }
-
     // glpsPollEvents();
     glps_wm_should_close(ctx.wm);
     glps_wm_window_update(ctx.wm, 0);
-    return ctx.current_event;
+}
+
+bool glps_pop_event(GooeyEvent *event)
+{
+    if (!GooeyEventQueue_Pop(&ctx.event_queue, event))
+        return false;
+
+    // Kept as the event being handled, for GetCurrentClickedWindow and HideCurrentChild.
+    *ctx.current_event = *event;
+    return true;
 }
 
 void glps_hide_current_child(void)
@@ -714,6 +877,35 @@ void glps_cleanup()
         ctx.shape_vaos = NULL;
     }
 
+    if (ctx.series_vaos)
+    {
+        free(ctx.series_vaos);
+        ctx.series_vaos = NULL;
+    }
+
+    if (ctx.marker_vaos)
+    {
+        free(ctx.marker_vaos);
+        ctx.marker_vaos = NULL;
+    }
+
+    if (ctx.heatmap_vaos)
+    {
+        free(ctx.heatmap_vaos);
+        ctx.heatmap_vaos = NULL;
+    }
+
+    free(ctx.series.items);
+    ctx.series = (SeriesPool){0};
+    free(ctx.heatmaps.items);
+    ctx.heatmaps = (HeatmapPool){0};
+
+    if (ctx.viewports)
+    {
+        free(ctx.viewports);
+        ctx.viewports = NULL;
+    }
+
     /*
        if (ctx.user_ptrs)
     {
@@ -816,11 +1008,23 @@ GooeyBackend glps_backend = {
     .Cleanup = glps_cleanup,
     .Render = glps_render,
     .HandleEvents = glps_handle_events,
-    .InhibitResetEvents = glps_reset_events,
+    .PopEvent = glps_pop_event,
     .FillArc = glps_fill_arc,
     .FillRectangle = glps_fill_rectangle,
     .DrawRectangle = glps_draw_rectangle,
     .DrawLine = glps_draw_line,
+    .DrawPolyline = glps_draw_polyline,
+    .DrawPoints = glps_draw_points,
+    .DrawMarkers = glps_draw_markers,
+    .CreateSeries = glps_create_series,
+    .UploadSeries = glps_upload_series,
+    .DrawSeries = glps_draw_series,
+    .DestroySeries = glps_destroy_series,
+    .CreateHeatmap = glps_create_heatmap,
+    .UploadHeatmapRows = glps_upload_heatmap_rows,
+    .UploadHeatmapColormap = glps_upload_heatmap_colormap,
+    .DrawHeatmap = glps_draw_heatmap,
+    .DestroyHeatmap = glps_destroy_heatmap,
     .SetForeground = glps_set_foreground,
     .GetTextWidth = glps_get_text_width,
     .GetTextHeight = glps_get_text_height,
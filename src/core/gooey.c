@@ -63,3 +63,17 @@ int Gooey_Init(GooeyBackends backend)
     return 0;
 }
 
+void Gooey_SetFrameMode(GOOEY_FRAME_MODE mode, int target_fps)
+{
+    GooeyFrameScheduler_SetMode(mode, target_fps);
+
+    if (active_backend && active_backend->SetSwapInterval)
+        active_backend->SetSwapInterval(mode == GOOEY_FRAME_VSYNC ? 1 : 0);
+}
+
+void Gooey_WakeUp(void)
+{
+    if (active_backend && active_backend->WakeUp)
+        active_backend->WakeUp();
+}
+
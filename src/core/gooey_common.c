@@ -22,10 +22,103 @@ GooeyBackend *active_backend = NULL;
 GooeyTheme *active_theme;
 GooeyBackends ACTIVE_BACKEND = -1;
 
+/** Bumped on every theme change so each window knows it has to be repainted entirely. */
+static unsigned int active_theme_generation = 0;
+
+/** Bumped whenever a widget moves so each window knows its hit index may be stale. */
+static unsigned int widget_geometry_generation = 0;
+
+/**
+ * @brief Area of a widget that reacts to clicks, empty for widgets that ignore the pointer.
+ */
+static GooeyRect widget_hit_bounds(GooeyWindow *win, GooeyWidget *widget)
+{
+    switch (widget->type)
+    {
+    case WIDGET_BUTTON:
+    case WIDGET_CHECKBOX:
+    case WIDGET_DROPDOWN:
+    case WIDGET_TEXTBOX:
+        return (GooeyRect){widget->x, widget->y, widget->width, widget->height};
+
+    case WIDGET_SLIDER:
+        return (GooeyRect){widget->x, widget->y - SLIDER_GRAB_MARGIN, widget->width, widget->height + SLIDER_GRAB_MARGIN * 2};
+
+    case WIDGET_LIST:
+        return (GooeyRect){widget->x, widget->y, widget->width + ((GooeyList *)widget)->thumb_width, widget->height};
+
+    case WIDGET_RADIOBUTTON:
+    {
+        GooeyRadioButton *button = (GooeyRadioButton *)widget;
+
+        // Standalone buttons are positioned by their center, grouped ones by their top-left corner with a wider grab area.
+        if (button >= win->radio_buttons && button < win->radio_buttons + win->radio_button_count)
+            return (GooeyRect){widget->x - button->radius, widget->y - button->radius, button->radius * 2, button->radius * 2};
+
+        return (GooeyRect){widget->x - 10, widget->y - 10, RADIO_BUTTON_RADIUS * 2 + 20, RADIO_BUTTON_RADIUS * 2 + 20};
+    }
+
+    default:
+        return (GooeyRect){0};
+    }
+}
+
 void GooeyWindow_RegisterWidget(GooeyWindow *win, GooeyWidget *widget)
 {
-    if (win && win->widgets)
-        win->widgets[win->widget_count++] = widget;
+    if (!win || !win->widgets)
+        return;
+
+    if (win->widget_count == win->widget_capacity)
+    {
+        size_t new_capacity = win->widget_capacity * 2;
+        GooeyWidget **widgets = realloc(win->widgets, sizeof(GooeyWidget *) * new_capacity);
+        if (!widgets)
+        {
+            LOG_ERROR("Failed to grow the widget registry.");
+            return;
+        }
+
+        win->widgets = widgets;
+        win->widget_capacity = new_capacity;
+    }
+
+    widget->registry_index = win->widget_count;
+    widget->has_moved = false;
+    widget->paint_bounds = (GooeyRect){0};
+    widget->is_dirty = true;
+    win->widgets[win->widget_count++] = widget;
+    GooeySpatialIndex_Set(&win->hit_index, widget->registry_index, widget_hit_bounds(win, widget));
+}
+
+void GooeyWidget_MarkMoved(GooeyWidget *widget)
+{
+    widget->has_moved = true;
+    widget->is_dirty = true;
+    widget_geometry_generation++;
+}
+
+GooeyWidget *GooeyWindow_WidgetAt(GooeyWindow *win, int x, int y)
+{
+    // Only the widgets flagged as moved are reindexed, and only after some widget actually moved.
+    if (win->geometry_generation != widget_geometry_generation)
+    {
+        for (size_t i = 0; i < win->widget_count; ++i)
+        {
+            if (!win->widgets[i]->has_moved)
+                continue;
+
+            GooeySpatialIndex_Set(&win->hit_index, i, widget_hit_bounds(win, win->widgets[i]));
+            win->widgets[i]->has_moved = false;
+        }
+
+        win->geometry_generation = widget_geometry_generation;
+    }
+
+    size_t index;
+    if (!GooeySpatialIndex_QueryTopmost(&win->hit_index, x, y, &index))
+        return NULL;
+
+    return win->widgets[index];
 }
 
 void GooeyWindow_MakeVisible(GooeyWindow *win, bool visibility)
@@ -41,31 +134,12 @@ void GooeyWindow_MakeResizable(GooeyWindow *msgBoxWindow, bool is_resizable)
 
 bool GooeyWindow_HandleCursorChange(GooeyWindow *win, GOOEY_CURSOR *cursor, int x, int y)
 {
-    for (size_t i = 0; i < win->widget_count; ++i)
-    {
-        if (x >= win->widgets[i]->x && x <= win->widgets[i]->x + win->widgets[i]->width &&
-            y >= win->widgets[i]->y && y <= win->widgets[i]->y + win->widgets[i]->height)
-        {
-            switch (win->widgets[i]->type)
-            {
-            case WIDGET_TEXTBOX:
-                *cursor = GOOEY_CURSOR_TEXT;
-                break;
-
-            case WIDGET_LABEL:
-                *cursor = GOOEY_CURSOR_ARROW;
-                break;
-            default:
-
-                *cursor = GOOEY_CURSOR_HAND;
-                break;
-            }
-
-            return true;
-        }
-    }
+    GooeyWidget *widget = GooeyWindow_WidgetAt(win, x, y);
+    if (!widget)
+        return false;
 
-    return false;
+    *cursor = widget->type == WIDGET_TEXTBOX ? GOOEY_CURSOR_TEXT : GOOEY_CURSOR_HAND;
+    return true;
 }
 
 void GooeyWindow_SetTheme(const char *fontPath)
@@ -74,6 +148,7 @@ void GooeyWindow_SetTheme(const char *fontPath)
     if (active_backend)
     {
         *active_theme = parser_load_theme_from_file(fontPath);
+        active_theme_generation++;
         active_backend->UpdateBackground();
     }
 }
@@ -183,11 +258,14 @@ void GooeyWindow_FreeResources(GooeyWindow *win)
     {
         for (size_t i = 0; i < win->list_count; ++i)
         {
-            if (win->lists[i].items)
-            {
-                free(win->lists[i].items);
-                win->lists[i].items = NULL;
-            }
+            free(win->lists[i].items);
+            win->lists[i].items = NULL;
+            free(win->lists[i].strings);
+            win->lists[i].strings = NULL;
+            free(win->lists[i].cache);
+            win->lists[i].cache = NULL;
+            free(win->lists[i].filtered);
+            win->lists[i].filtered = NULL;
         }
         free(win->lists);
         win->lists = NULL;
@@ -195,6 +273,8 @@ void GooeyWindow_FreeResources(GooeyWindow *win)
 
     if(win->plots) 
     {
+        for (size_t i = 0; i < win->plot_count; ++i)
+            GooeyPlot_Release(&win->plots[i]);
         free(win->plots);
         win->plots = NULL;
     }
@@ -204,12 +284,15 @@ void GooeyWindow_FreeResources(GooeyWindow *win)
         free(win->widgets);
         win->widgets = NULL;
     }
+
+    GooeySpatialIndex_Free(&win->hit_index);
 }
 
 GooeyWindow GooeyWindow_Create(const char *title, int width, int height, bool visibilty)
 {
     GooeyWindow win = active_backend->CreateWindow(title, width, height);
     win.type = WINDOW_REGULAR;
+    GooeySpatialIndex_Init(&win.hit_index);
     if (!GooeyWindow_AllocateResources(&win))
     {
         GooeyWindow_Cleanup(1, &win);
@@ -231,6 +314,13 @@ GooeyWindow GooeyWindow_Create(const char *title, int width, int height, bool vi
     win.layout_count = 0;
     win.list_count = 0;
     win.widget_count = 0;
+    win.widget_capacity = MAX_WIDGETS;
+    win.current_cursor = GOOEY_CURSOR_ARROW;
+    win.pressed_button = -1;
+    win.geometry_generation = widget_geometry_generation;
+    win.needs_full_redraw = true;
+    win.frame = (GooeyFrameState){0};
+    GooeyFrameScheduler_Request(&win.frame);
     LOG_INFO("Window created with dimensions (%d, %d).", width, height);
     return win;
 }
@@ -240,6 +330,7 @@ GooeyWindow GooeyWindow_CreateChild(const char *title, int width, int height, bo
     GooeyWindow win = active_backend->SpawnWindow(title, width, height, visibility);
 
     win.type = WINDOW_REGULAR;
+    GooeySpatialIndex_Init(&win.hit_index);
     if (!GooeyWindow_AllocateResources(&win))
     {
         GooeyWindow_FreeResources(&win);
@@ -262,12 +353,190 @@ GooeyWindow GooeyWindow_CreateChild(const char *title, int width, int height, bo
     win.layout_count = 0;
     win.list_count = 0;
     win.widget_count = 0;
+    win.widget_capacity = MAX_WIDGETS;
+    win.current_cursor = GOOEY_CURSOR_ARROW;
+    win.pressed_button = -1;
+    win.geometry_generation = widget_geometry_generation;
+    win.needs_full_redraw = true;
+    win.frame = (GooeyFrameState){0};
+    GooeyFrameScheduler_Request(&win.frame);
     LOG_INFO("Window created with dimensions (%d, %d).", width, height);
     return win;
 }
 
+void GooeyWidget_MarkDirty(GooeyWidget *widget)
+{
+    if (widget)
+        widget->is_dirty = true;
+}
+
+void GooeyWindow_RequestFullRedraw(GooeyWindow *win)
+{
+    win->needs_full_redraw = true;
+    GooeyFrameScheduler_Request(&win->frame);
+}
+
+void GooeyWindow_RequestRedraw(GooeyWindow *win)
+{
+    GooeyFrameScheduler_Request(&win->frame);
+}
+
+void GooeyWindow_PostRedraw(GooeyWindow *win)
+{
+    GooeyFrameScheduler_Post(&win->frame);
+
+    if (active_backend->WakeUp)
+        active_backend->WakeUp();
+}
+
+unsigned long GooeyWindow_GetMissedFrames(GooeyWindow *win)
+{
+    return win->frame.missed_deadlines;
+}
+
+/**
+ * @brief Area a widget paints, which can go past its core bounds (labels, hints, outlines).
+ *
+ * Measures text, so it's only run for the widgets being repainted and cached in their paint_bounds.
+ */
+static GooeyRect widget_paint_bounds(GooeyWindow *win, GooeyWidget *widget)
+{
+    GooeyRect bounds = {widget->x, widget->y, widget->width, widget->height};
+
+    switch (widget->type)
+    {
+    case WIDGET_LABEL:
+    {
+        GooeyLabel *label = (GooeyLabel *)widget;
+        int window_width, window_height;
+        float scale = label->font_size / 0.25f;
+        int text_height = active_backend->GetTextHeight(label->text, strlen(label->text)) * scale;
+
+        // Text is drawn from its baseline and wraps at the window edge, so the whole row is claimed.
+        active_backend->GetWinDim(&window_width, &window_height, win->creation_id);
+        bounds = (GooeyRect){widget->x, widget->y - text_height, window_width - widget->x, text_height * 2};
+        break;
+    }
+
+    case WIDGET_CHECKBOX:
+    {
+        GooeyCheckbox *checkbox = (GooeyCheckbox *)widget;
+        bounds.width += 10 + active_backend->GetTextWidth(checkbox->label, strlen(checkbox->label));
+        break;
+    }
+
+    case WIDGET_RADIOBUTTON:
+    {
+        GooeyRadioButton *button = (GooeyRadioButton *)widget;
+        bounds.y -= RADIO_BUTTON_RADIUS;
+        bounds.width = RADIO_BUTTON_RADIUS * 2 + 10 + active_backend->GetTextWidth(button->label, strlen(button->label));
+        bounds.height = RADIO_BUTTON_RADIUS * 3;
+        break;
+    }
+
+    case WIDGET_SLIDER:
+    {
+        // Covers the thumb overhang and the min, max and value hints around the track.
+        GooeySlider *slider = (GooeySlider *)widget;
+        char min_value[20], max_value[20];
+        sprintf(min_value, "%ld", slider->min_value);
+        sprintf(max_value, "%ld", slider->max_value);
+        int min_value_width = active_backend->GetTextWidth(min_value, strlen(min_value));
+        int max_value_width = active_backend->GetTextWidth(max_value, strlen(max_value));
+
+        bounds.x -= min_value_width + 10;
+        bounds.y -= 10;
+        bounds.width += min_value_width + max_value_width + 20;
+        bounds.height += 40;
+        break;
+    }
+
+    case WIDGET_LIST:
+        bounds.width += ((GooeyList *)widget)->thumb_width;
+        break;
+
+    default:
+        break;
+    }
+
+    // Outlines are drawn on the bounds themselves.
+    bounds.x -= 1;
+    bounds.y -= 1;
+    bounds.width += 2;
+    bounds.height += 2;
+    return bounds;
+}
+
+static bool rect_intersects(GooeyRect a, GooeyRect b)
+{
+    return a.x < b.x + b.width && b.x < a.x + a.width &&
+           a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+static GooeyRect rect_union(GooeyRect a, GooeyRect b)
+{
+    if (a.width <= 0 || a.height <= 0)
+        return b;
+
+    int x1 = a.x < b.x ? a.x : b.x;
+    int y1 = a.y < b.y ? a.y : b.y;
+    int x2 = a.x + a.width > b.x + b.width ? a.x + a.width : b.x + b.width;
+    int y2 = a.y + a.height > b.y + b.height ? a.y + a.height : b.y + b.height;
+    return (GooeyRect){x1, y1, x2 - x1, y2 - y1};
+}
+
+bool GooeyWindow_IsDamaged(GooeyWindow *win, GooeyWidget *widget)
+{
+    return rect_intersects(win->damage, widget->paint_bounds);
+}
+
 void GooeyWindow_Redraw(GooeyWindow *win)
 {
+    int window_width, window_height;
+    active_backend->GetWinDim(&window_width, &window_height, win->creation_id);
+
+    // Samples posted from other threads are appended first so the plots they change get repainted.
+    GooeyPlot_DrainPosted(win);
+
+    GooeyRect damage = {0};
+    bool full_redraw = win->needs_full_redraw || win->theme_generation != active_theme_generation ||
+                       !active_backend->SetClipRect;
+
+    if (!full_redraw)
+    {
+        for (size_t i = 0; i < win->widget_count; ++i)
+        {
+            GooeyWidget *widget = win->widgets[i];
+            if (!widget->is_dirty)
+                continue;
+
+            // A widget that moved or grew leaves the area it used to cover to be repainted too.
+            GooeyRect bounds = widget_paint_bounds(win, widget);
+            damage = rect_union(damage, rect_union(widget->paint_bounds, bounds));
+            widget->paint_bounds = bounds;
+        }
+
+        // Nothing was flagged, so whatever changed is unknown and everything gets repainted.
+        full_redraw = damage.width <= 0 || damage.height <= 0;
+    }
+
+    if (full_redraw)
+    {
+        damage = (GooeyRect){0, 0, window_width, window_height};
+        for (size_t i = 0; i < win->widget_count; ++i)
+            win->widgets[i]->paint_bounds = widget_paint_bounds(win, win->widgets[i]);
+    }
+
+    win->damage = damage;
+
+    if (active_backend->SetClipRect)
+    {
+        if (full_redraw)
+            active_backend->SetClipRect(win->creation_id, 0, 0, 0, 0);
+        else
+            active_backend->SetClipRect(win->creation_id, damage.x, damage.y, damage.width, damage.height);
+    }
+
     active_backend->Clear(win->creation_id);
     GooeyList_Draw(win);
     GooeyLabel_Draw(win);
@@ -282,7 +551,14 @@ void GooeyWindow_Redraw(GooeyWindow *win)
     GooeyMenu_Draw(win);
     
     active_backend->Render(win->creation_id);
-    usleep(16667);
+    GooeyFrameScheduler_FramePresented(&win->frame, GooeyFrameScheduler_Now());
+
+    for (size_t i = 0; i < win->widget_count; ++i)
+    {
+        win->widgets[i]->is_dirty = false;
+    }
+    win->needs_full_redraw = false;
+    win->theme_generation = active_theme_generation;
 }
 
 void GooeyWindow_Cleanup(int num_windows, GooeyWindow *first_win, ...)
@@ -312,10 +588,181 @@ void GooeyWindow_Cleanup(int num_windows, GooeyWindow *first_win, ...)
     LOG_INFO("Cleanup.");
 }
 
+/**
+ * @brief Routes a click to the overlay or widget on top at that point.
+ *
+ * @return true if something handled the click.
+ */
+static bool dispatch_click(GooeyWindow *win, int x, int y)
+{
+    // Open menus and dropdown lists float above the widgets, they get the click first.
+    bool menu_was_open = win->menu && win->menu->is_busy;
+    GooeyMenu_HandleClick(win, x, y);
+    if (menu_was_open || (win->menu && win->menu->is_busy))
+        return false;
+
+    if (GooeyDropdown_HandleOptionClick(win, x, y))
+        return true;
+
+    GooeyWidget *target = GooeyWindow_WidgetAt(win, x, y);
+
+    // Always called, a click anywhere releases the button shown pressed.
+    if (GooeyButton_HandleClickOn(win, target && target->type == WIDGET_BUTTON ? (GooeyButton *)target : NULL))
+        return true;
+
+    if (!target)
+        return false;
+
+    switch (target->type)
+    {
+    case WIDGET_CHECKBOX:
+        return GooeyCheckbox_HandleClickOn((GooeyCheckbox *)target);
+
+    case WIDGET_RADIOBUTTON:
+        return GooeyRadioButton_HandleClickOn(win, (GooeyRadioButton *)target, x, y);
+
+    case WIDGET_DROPDOWN:
+        return GooeyDropdown_HandleClickOn(win, (GooeyDropdown *)target);
+
+    case WIDGET_TEXTBOX:
+        return GooeyTextbox_HandleClickOn(win, (GooeyTextbox *)target);
+
+    case WIDGET_SLIDER:
+        return GooeySlider_HandleClickOn((GooeySlider *)target, x);
+
+    case WIDGET_LIST:
+        return GooeyList_HandleClickOn((GooeyList *)target, x, y);
+
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Switches the cursor shape when the pointer enters or leaves an interactive widget.
+ */
+static void update_cursor(GooeyWindow *win, int x, int y)
+{
+    GOOEY_CURSOR cursor = GOOEY_CURSOR_ARROW;
+    GooeyWindow_HandleCursorChange(win, &cursor, x, y);
+
+    if (cursor == win->current_cursor || !active_backend->SetCursor)
+        return;
+
+    active_backend->SetCursor(cursor);
+    win->current_cursor = cursor;
+}
+
+/**
+ * @brief Hands one event to the widgets of the window it belongs to.
+ *
+ * @return false if the event asks the application to quit.
+ */
+static bool dispatch_event(GooeyWindow *win, GooeyEvent *event)
+{
+    bool running = true;
+    int x = event->mouse_move.x;
+    int y = event->mouse_move.y;
+
+    switch (event->type)
+    {
+    case GOOEY_EVENT_EXPOSE:
+        GooeyWindow_RequestFullRedraw(win);
+        break;
+
+    case GOOEY_EVENT_KEY_PRESS:
+        if (win->creation_id == event->attached_window)
+        {
+            bool typed = GooeyTextbox_HandleKeyPress(win, event);
+            if (GooeyList_HandleScroll(win, event) || GooeySlider_HandleDrag(win, event) || typed)
+            {
+                GooeyWindow_RequestRedraw(win);
+            }
+        }
+
+        break;
+
+    case GOOEY_EVENT_CLICK_PRESS:
+        if (win->creation_id == event->attached_window)
+        {
+            if (dispatch_click(win, x, y))
+            {
+                GooeyWindow_RequestRedraw(win);
+            }
+        }
+        break;
+
+    case GOOEY_EVENT_CLICK_RELEASE:
+        if (win->creation_id == event->attached_window)
+        {
+
+            if (GooeySlider_HandleDrag(win, event) || GooeyList_HandleThumbScroll(win, event))
+            {
+                GooeyWindow_RequestRedraw(win);
+            }
+        }
+        break;
+
+    case GOOEY_EVENT_MOUSE_MOVE:
+        if (win->creation_id == event->attached_window)
+        {
+            if (GooeySlider_HandleDrag(win, event) || GooeyList_HandleThumbScroll(win, event))
+            {
+                GooeyWindow_RequestRedraw(win);
+            }
+            else
+            {
+                update_cursor(win, x, y);
+            }
+        }
+        break;
+
+    case GOOEY_EVENT_MOUSE_SCROLL:
+        if (win->creation_id == event->attached_window)
+        {
+
+            if (GooeyList_HandleScroll(win, event))
+            {
+                GooeyWindow_RequestRedraw(win);
+            }
+        }
+        break;
+
+    case GOOEY_EVENT_WINDOW_CLOSE:
+        running = false;
+        break;
+
+    default:
+
+        break;
+    }
+
+    return running;
+}
+
+/**
+ * @brief Seconds until the earliest pending frame is due, negative if no window has one.
+ */
+static double next_frame_timeout(GooeyWindow **windows, int num_windows)
+{
+    double now = GooeyFrameScheduler_Now();
+    double timeout = -1.0;
+
+    for (int i = 0; i < num_windows; ++i)
+    {
+        GooeyFrameScheduler_CollectPosted(&windows[i]->frame);
+
+        double remaining = GooeyFrameScheduler_TimeUntilDue(&windows[i]->frame, now);
+        if (remaining >= 0.0 && (timeout < 0.0 || remaining < timeout))
+            timeout = remaining;
+    }
+
+    return timeout;
+}
+
 void GooeyWindow_Run(int num_windows, GooeyWindow *first_win, ...)
 {
 
-    GooeyEvent *event;
     bool running = true;
 
     va_list args;
@@ -341,80 +788,35 @@ void GooeyWindow_Run(int num_windows, GooeyWindow *first_win, ...)
     while (running)
     {
 
-        event = active_backend->HandleEvents();
-        for (int i = 0; i < num_windows; ++i)
+        // Block until input arrives or a frame is due, so idle windows cost no CPU.
+        double timeout = next_frame_timeout(windows, num_windows);
+        if (active_backend->WaitEvents)
         {
-            win = windows[i];
-
-            int x = event->mouse_move.x;
-            int y = event->mouse_move.y;
+            active_backend->WaitEvents(timeout);
+        }
+        else
+        {
+            active_backend->HandleEvents();
+            GooeyFrameScheduler_Sleep(timeout < 0.0 ? GooeyFrameScheduler_GetInterval() : timeout);
+        }
 
-            switch (event->type)
+        GooeyEvent event;
+        while (active_backend->PopEvent(&event))
+        {
+            for (int i = 0; i < num_windows; ++i)
             {
-            case GOOEY_EVENT_EXPOSE:
-                GooeyWindow_Redraw(win);
-                break;
-
-            case GOOEY_EVENT_KEY_PRESS:
-                if (win->creation_id == event->attached_window)
-                {
-                    GooeyTextbox_HandleKeyPress(win, event);
-                    if (GooeyList_HandleScroll(win, event) || GooeySlider_HandleDrag(win, event))
-                    {
-                        GooeyWindow_Redraw(win);
-                    }
-                }
-
-                break;
-
-            case GOOEY_EVENT_CLICK_PRESS:
-                if (win->creation_id == event->attached_window)
-                {
-
-                    GooeyMenu_HandleClick(win, x, y);
-                    if (GooeySlider_HandleDrag(win, event) || GooeyButton_HandleClick(win, x, y) ||
-                        GooeyRadioButtonGroup_HandleClick(win, x, y) ||
-                        GooeyCheckbox_HandleClick(win, x, y) ||
-                        GooeyRadioButton_HandleClick(win, x, y) ||
-                        GooeyDropdown_HandleClick(win, x, y) ||
-                        GooeyTextbox_HandleClick(win, x, y) || GooeyList_HandleThumbScroll(win, event) || GooeyList_HandleClick(win, x, y))
-                    {
-                        GooeyWindow_Redraw(win);
-                    }
-
-                }
-                break;
-
-            case GOOEY_EVENT_CLICK_RELEASE:
-                if (win->creation_id == event->attached_window)
-                {
-
-                    if (GooeySlider_HandleDrag(win, event) || GooeyList_HandleThumbScroll(win, event))
-                    {
-                        GooeyWindow_Redraw(win);
-                    }
-                }
-                break;
-
-            case GOOEY_EVENT_MOUSE_SCROLL:
-                if (win->creation_id == event->attached_window)
-                {
-
-                    if (GooeyList_HandleScroll(win, event))
-                    {
-                        GooeyWindow_Redraw(win);
-                    }
-                }
-                break;
-
-            case GOOEY_EVENT_WINDOW_CLOSE:
-                running = false;
-                break;
-
-            default:
-
-                break;
+                if (!dispatch_event(windows[i], &event))
+                    running = false;
             }
         }
+
+        // Every request made while handling the events is now known, draw the windows whose frame is due.
+        double now = GooeyFrameScheduler_Now();
+        for (int i = 0; i < num_windows; ++i)
+        {
+            GooeyFrameScheduler_CollectPosted(&windows[i]->frame);
+            if (GooeyFrameScheduler_TimeUntilDue(&windows[i]->frame, now) == 0.0)
+                GooeyWindow_Redraw(windows[i]);
+        }
     }
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+/*
+ Copyright (c) 2024 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/gooey_event_queue.h"
+#include "core/gooey_frame_scheduler.h"
+#include "utils/logger/gooey_logger_internal.h"
+
+void GooeyEventQueue_Init(GooeyEventQueue *queue)
+{
+    queue->head = 0;
+    queue->count = 0;
+    queue->dropped = 0;
+}
+
+bool GooeyEventQueue_Push(GooeyEventQueue *queue, const GooeyEvent *event)
+{
+    GooeyEvent stamped = *event;
+    stamped.timestamp = GooeyFrameScheduler_Now();
+
+    if (stamped.type == GOOEY_EVENT_MOUSE_MOVE && queue->count > 0)
+    {
+        GooeyEvent *tail = &queue->events[(queue->head + queue->count - 1) % GOOEY_EVENT_QUEUE_CAPACITY];
+        if (tail->type == GOOEY_EVENT_MOUSE_MOVE && tail->attached_window == stamped.attached_window)
+        {
+            *tail = stamped;
+            return true;
+        }
+    }
+
+    if (queue->count == GOOEY_EVENT_QUEUE_CAPACITY)
+    {
+        if (queue->dropped++ == 0)
+            LOG_ERROR("Event queue is full, dropping events.");
+        return false;
+    }
+
+    queue->events[(queue->head + queue->count) % GOOEY_EVENT_QUEUE_CAPACITY] = stamped;
+    queue->count++;
+    return true;
+}
+
+bool GooeyEventQueue_Pop(GooeyEventQueue *queue, GooeyEvent *event)
+{
+    if (queue->count == 0)
+        return false;
+
+    *event = queue->events[queue->head];
+    queue->head = (queue->head + 1) % GOOEY_EVENT_QUEUE_CAPACITY;
+    queue->count--;
+    return true;
+}
@@ -0,0 +1,120 @@
+/*
+ Copyright (c) 2024 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/gooey_frame_scheduler.h"
+#include <time.h>
+
+static GOOEY_FRAME_MODE frame_mode = GOOEY_FRAME_VSYNC;
+static double frame_interval = 1.0 / GOOEY_DEFAULT_REFRESH_RATE;
+
+double GooeyFrameScheduler_Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void GooeyFrameScheduler_SetMode(GOOEY_FRAME_MODE mode, int target_fps)
+{
+    frame_mode = mode;
+
+    switch (mode)
+    {
+    case GOOEY_FRAME_UNCAPPED:
+        frame_interval = 0.0;
+        break;
+
+    case GOOEY_FRAME_FIXED:
+    case GOOEY_FRAME_VSYNC:
+    default:
+        frame_interval = 1.0 / (target_fps > 0 ? target_fps : GOOEY_DEFAULT_REFRESH_RATE);
+        break;
+    }
+}
+
+GOOEY_FRAME_MODE GooeyFrameScheduler_GetMode(void)
+{
+    return frame_mode;
+}
+
+double GooeyFrameScheduler_GetInterval(void)
+{
+    return frame_interval;
+}
+
+void GooeyFrameScheduler_Request(GooeyFrameState *state)
+{
+    if (state->pending)
+        return;
+
+    state->pending = true;
+    state->requested_at = GooeyFrameScheduler_Now();
+}
+
+void GooeyFrameScheduler_Post(GooeyFrameState *state)
+{
+    atomic_store(&state->posted, true);
+}
+
+void GooeyFrameScheduler_CollectPosted(GooeyFrameState *state)
+{
+    if (atomic_exchange(&state->posted, false))
+        GooeyFrameScheduler_Request(state);
+}
+
+void GooeyFrameScheduler_Sleep(double seconds)
+{
+    if (seconds <= 0.0)
+        return;
+
+    struct timespec ts;
+    ts.tv_sec = (time_t)seconds;
+    ts.tv_nsec = (long)((seconds - ts.tv_sec) * 1e9);
+    nanosleep(&ts, NULL);
+}
+
+/**
+ * @brief Earliest time the pending frame may be drawn: on request, but no sooner than one interval after the previous frame.
+ */
+static double frame_due_time(const GooeyFrameState *state)
+{
+    double earliest = state->last_presented_at + frame_interval;
+
+    if (state->frame_count == 0 || state->requested_at > earliest)
+        return state->requested_at;
+
+    return earliest;
+}
+
+double GooeyFrameScheduler_TimeUntilDue(const GooeyFrameState *state, double now)
+{
+    if (!state->pending)
+        return -1.0;
+
+    double remaining = frame_due_time(state) - now;
+    return remaining > 0.0 ? remaining : 0.0;
+}
+
+void GooeyFrameScheduler_FramePresented(GooeyFrameState *state, double presented_at)
+{
+    if (state->pending && frame_interval > 0.0 && presented_at > frame_due_time(state) + frame_interval)
+        state->missed_deadlines++;
+
+    state->pending = false;
+    state->last_presented_at = presented_at;
+    state->frame_count++;
+}
@@ -0,0 +1,245 @@
+/*
+ Copyright (c) 2024 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/gooey_spatial_index.h"
+#include "utils/logger/gooey_logger_internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+void GooeySpatialIndex_Init(GooeySpatialIndex *index)
+{
+    *index = (GooeySpatialIndex){0};
+}
+
+static int cell_coordinate(int position)
+{
+    return position < 0 ? 0 : position / GOOEY_SPATIAL_CELL_SIZE;
+}
+
+static bool cell_insert(GooeySpatialCell *cell, size_t id)
+{
+    if (cell->count == cell->capacity)
+    {
+        size_t new_capacity = cell->capacity ? cell->capacity * 2 : 4;
+        size_t *new_ids = realloc(cell->ids, new_capacity * sizeof(size_t));
+        if (!new_ids)
+            return false;
+
+        cell->ids = new_ids;
+        cell->capacity = new_capacity;
+    }
+
+    // Ids are mostly registered in increasing order, so the insertion point is nearly always the end.
+    size_t position = cell->count;
+    while (position > 0 && cell->ids[position - 1] > id)
+        position--;
+
+    memmove(&cell->ids[position + 1], &cell->ids[position], (cell->count - position) * sizeof(size_t));
+    cell->ids[position] = id;
+    cell->count++;
+    return true;
+}
+
+static void cell_remove(GooeySpatialCell *cell, size_t id)
+{
+    for (size_t i = cell->count; i-- > 0;)
+    {
+        if (cell->ids[i] == id)
+        {
+            memmove(&cell->ids[i], &cell->ids[i + 1], (cell->count - i - 1) * sizeof(size_t));
+            cell->count--;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Calls `visit` on every cell the rect overlaps, stopping at the first failure.
+ */
+static bool for_each_cell(GooeySpatialIndex *index, GooeyRect bounds, size_t id, bool (*visit)(GooeySpatialCell *, size_t))
+{
+    int first_column = cell_coordinate(bounds.x);
+    int last_column = cell_coordinate(bounds.x + bounds.width);
+    int first_row = cell_coordinate(bounds.y);
+    int last_row = cell_coordinate(bounds.y + bounds.height);
+
+    for (int row = first_row; row <= last_row; ++row)
+    {
+        for (int column = first_column; column <= last_column; ++column)
+        {
+            if (!visit(&index->cells[row * index->columns + column], id))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+static bool visit_insert(GooeySpatialCell *cell, size_t id)
+{
+    return cell_insert(cell, id);
+}
+
+static bool visit_remove(GooeySpatialCell *cell, size_t id)
+{
+    cell_remove(cell, id);
+    return true;
+}
+
+/**
+ * @brief Grows the grid so it covers the rect, reindexing every entry into the new cells.
+ */
+static bool ensure_covers(GooeySpatialIndex *index, GooeyRect bounds)
+{
+    int needed_columns = cell_coordinate(bounds.x + bounds.width) + 1;
+    int needed_rows = cell_coordinate(bounds.y + bounds.height) + 1;
+
+    if (needed_columns <= index->columns && needed_rows <= index->rows)
+        return true;
+
+    int columns = index->columns ? index->columns : 1;
+    int rows = index->rows ? index->rows : 1;
+    while (columns < needed_columns)
+        columns *= 2;
+    while (rows < needed_rows)
+        rows *= 2;
+
+    GooeySpatialCell *cells = calloc((size_t)columns * rows, sizeof(GooeySpatialCell));
+    if (!cells)
+        return false;
+
+    GooeySpatialIndex grown = *index;
+    grown.cells = cells;
+    grown.columns = columns;
+    grown.rows = rows;
+
+    for (size_t id = 0; id < index->entry_capacity; ++id)
+    {
+        if (index->entries[id].indexed && !for_each_cell(&grown, index->entries[id].bounds, id, visit_insert))
+        {
+            for (int i = 0; i < columns * rows; ++i)
+                free(cells[i].ids);
+            free(cells);
+            return false;
+        }
+    }
+
+    for (int i = 0; i < index->columns * index->rows; ++i)
+        free(index->cells[i].ids);
+    free(index->cells);
+
+    index->cells = cells;
+    index->columns = columns;
+    index->rows = rows;
+    return true;
+}
+
+static bool ensure_entry(GooeySpatialIndex *index, size_t id)
+{
+    if (id < index->entry_capacity)
+        return true;
+
+    size_t new_capacity = index->entry_capacity ? index->entry_capacity : 64;
+    while (new_capacity <= id)
+        new_capacity *= 2;
+
+    GooeySpatialEntry *entries = realloc(index->entries, new_capacity * sizeof(GooeySpatialEntry));
+    if (!entries)
+        return false;
+
+    memset(&entries[index->entry_capacity], 0, (new_capacity - index->entry_capacity) * sizeof(GooeySpatialEntry));
+    index->entries = entries;
+    index->entry_capacity = new_capacity;
+    return true;
+}
+
+bool GooeySpatialIndex_Set(GooeySpatialIndex *index, size_t id, GooeyRect bounds)
+{
+    if (!ensure_entry(index, id))
+    {
+        LOG_ERROR("Failed to grow the spatial index.");
+        return false;
+    }
+
+    GooeySpatialEntry *entry = &index->entries[id];
+    bool empty = bounds.width <= 0 || bounds.height <= 0;
+
+    if (entry->indexed)
+    {
+        if (!empty && memcmp(&entry->bounds, &bounds, sizeof(GooeyRect)) == 0)
+            return true;
+
+        for_each_cell(index, entry->bounds, id, visit_remove);
+        entry->indexed = false;
+    }
+
+    if (empty)
+        return true;
+
+    if (!ensure_covers(index, bounds))
+    {
+        LOG_ERROR("Failed to grow the spatial index.");
+        return false;
+    }
+
+    if (!for_each_cell(index, bounds, id, visit_insert))
+    {
+        // Undo the partial insertion so the entry is either fully indexed or not at all.
+        for_each_cell(index, bounds, id, visit_remove);
+        LOG_ERROR("Failed to grow the spatial index.");
+        return false;
+    }
+
+    entry->bounds = bounds;
+    entry->indexed = true;
+    return true;
+}
+
+bool GooeySpatialIndex_QueryTopmost(const GooeySpatialIndex *index, int x, int y, size_t *id)
+{
+    if (!index->cells)
+        return false;
+
+    int column = cell_coordinate(x);
+    int row = cell_coordinate(y);
+    if (column >= index->columns || row >= index->rows)
+        return false;
+
+    const GooeySpatialCell *cell = &index->cells[row * index->columns + column];
+    for (size_t i = cell->count; i-- > 0;)
+    {
+        const GooeyRect *bounds = &index->entries[cell->ids[i]].bounds;
+        if (x >= bounds->x && x <= bounds->x + bounds->width &&
+            y >= bounds->y && y <= bounds->y + bounds->height)
+        {
+            *id = cell->ids[i];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void GooeySpatialIndex_Free(GooeySpatialIndex *index)
+{
+    for (int i = 0; i < index->columns * index->rows; ++i)
+        free(index->cells[i].ids);
+
+    free(index->cells);
+    free(index->entries);
+    *index = (GooeySpatialIndex){0};
+}
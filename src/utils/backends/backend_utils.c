@@ -46,26 +46,623 @@ void check_shader_link(GLuint program)
     }
 }
 
-void get_window_size(GLFWwindow *window, int *window_width, int *window_height)
+GLuint compile_program(const char *vertex_source, const char *fragment_source)
 {
-    glfwGetFramebufferSize(window, window_width, window_height);
+    GLuint vertex_shader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertex_shader, 1, &vertex_source, NULL);
+    glCompileShader(vertex_shader);
+    check_shader_compile(vertex_shader);
+
+    GLuint fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragment_shader, 1, &fragment_source, NULL);
+    glCompileShader(fragment_shader);
+    check_shader_compile(fragment_shader);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertex_shader);
+    glAttachShader(program, fragment_shader);
+    glLinkProgram(program);
+    check_shader_link(program);
+
+    // The linked program keeps what it needs, the shader objects can go.
+    glDeleteShader(vertex_shader);
+    glDeleteShader(fragment_shader);
+    return program;
+}
+
+void set_window_viewport(WindowViewport *viewport, int width, int height)
+{
+    viewport->width = width;
+    viewport->height = height;
+    mat4x4_ortho(viewport->projection, 0.0f, width, height, 0.0f, -1.0f, 1.0f);
+}
+
+void gl_state_reset(GLStateCache *state)
+{
+    glUseProgram(0);
+    glBindVertexArray(0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    *state = (GLStateCache){0};
+}
+
+void gl_state_use_program(GLStateCache *state, GLuint program)
+{
+    if (state->program == program)
+        return;
+
+    glUseProgram(program);
+    state->program = program;
+}
+
+void gl_state_bind_vertex_array(GLStateCache *state, GLuint vao)
+{
+    if (state->vao == vao)
+        return;
+
+    glBindVertexArray(vao);
+    state->vao = vao;
+}
+
+void gl_state_bind_texture(GLStateCache *state, GLuint texture)
+{
+    if (state->texture == texture)
+        return;
+
+    // Only unit 0 is ever used, so the active unit never has to change.
+    glBindTexture(GL_TEXTURE_2D, texture);
+    state->texture = texture;
+}
+
+static bool vertex_stream_grow(void **buffer, size_t *capacity, size_t required, size_t element_size)
+{
+    if (required <= *capacity)
+        return true;
+
+    size_t new_capacity = *capacity ? *capacity : 256;
+    while (new_capacity < required)
+        new_capacity *= 2;
+
+    void *new_buffer = realloc(*buffer, new_capacity * element_size);
+    if (!new_buffer)
+    {
+        LOG_ERROR("Failed to grow vertex stream to %zu elements.", new_capacity);
+        return false;
+    }
+
+    *buffer = new_buffer;
+    *capacity = new_capacity;
+    return true;
+}
+
+static bool vertex_stream_push_run(VertexStream *stream, DrawPipeline pipeline, GLenum mode, size_t first, size_t count)
+{
+    DrawRun *last_run = stream->run_count ? &stream->runs[stream->run_count - 1] : NULL;
+    bool mergeable = mode == GL_TRIANGLES || mode == GL_LINES || mode == GL_POINTS;
+
+    if (last_run && mergeable && last_run->pipeline == pipeline && last_run->mode == mode)
+    {
+        last_run->count += count;
+        return true;
+    }
+
+    if (!vertex_stream_grow((void **)&stream->runs, &stream->run_capacity, stream->run_count + 1, sizeof(DrawRun)))
+        return false;
+
+    stream->runs[stream->run_count++] = (DrawRun){.pipeline = pipeline, .mode = mode, .first = first, .count = count};
+    return true;
+}
+
+Vertex *vertex_stream_reserve(VertexStream *stream, GLenum mode, size_t count)
+{
+    if (!vertex_stream_grow((void **)&stream->vertices, &stream->vertex_capacity, stream->vertex_count + count, sizeof(Vertex)))
+        return NULL;
+
+    if (!vertex_stream_push_run(stream, DRAW_PIPELINE_SHAPE, mode, stream->vertex_count, count))
+        return NULL;
+
+    Vertex *vertices = &stream->vertices[stream->vertex_count];
+    stream->vertex_count += count;
+    return vertices;
+}
+
+GlyphVertex *vertex_stream_reserve_glyphs(VertexStream *stream, size_t count)
+{
+    if (!vertex_stream_grow((void **)&stream->glyphs, &stream->glyph_capacity, stream->glyph_count + count, sizeof(GlyphVertex)))
+        return NULL;
+
+    if (!vertex_stream_push_run(stream, DRAW_PIPELINE_GLYPH, GL_TRIANGLES, stream->glyph_count, count))
+        return NULL;
+
+    GlyphVertex *vertices = &stream->glyphs[stream->glyph_count];
+    stream->glyph_count += count;
+    return vertices;
+}
+
+void vertex_stream_flush(VertexStream *stream, const DrawPipelineTarget targets[DRAW_PIPELINE_COUNT], GLStateCache *state)
+{
+    if (stream->run_count == 0)
+        return;
+
+    if (stream->vertex_count)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, targets[DRAW_PIPELINE_SHAPE].vbo);
+        glBufferData(GL_ARRAY_BUFFER, stream->vertex_count * sizeof(Vertex), stream->vertices, GL_STREAM_DRAW);
+    }
+
+    if (stream->glyph_count)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, targets[DRAW_PIPELINE_GLYPH].vbo);
+        glBufferData(GL_ARRAY_BUFFER, stream->glyph_count * sizeof(GlyphVertex), stream->glyphs, GL_STREAM_DRAW);
+    }
+
+    for (size_t i = 0; i < stream->run_count; ++i)
+    {
+        const DrawRun *run = &stream->runs[i];
+        const DrawPipelineTarget *target = &targets[run->pipeline];
+
+        gl_state_use_program(state, target->program);
+        gl_state_bind_vertex_array(state, target->vao);
+        if (target->texture)
+            gl_state_bind_texture(state, target->texture);
+
+        glDrawArrays(run->mode, run->first, run->count);
+    }
+
+    stream->vertex_count = 0;
+    stream->glyph_count = 0;
+    stream->run_count = 0;
+}
+
+void vertex_stream_free(VertexStream *stream)
+{
+    free(stream->vertices);
+    free(stream->glyphs);
+    free(stream->runs);
+    *stream = (VertexStream){0};
+}
+
+static void set_shape_vertex(Vertex *vertex, float x, float y, vec3 color)
+{
+    vertex->pos[0] = x;
+    vertex->pos[1] = y;
+    vertex->col[0] = color[0];
+    vertex->col[1] = color[1];
+    vertex->col[2] = color[2];
+}
+
+/**
+ * @brief Two triangles covering the quad whose corners are given in order around its edge.
+ */
+static void set_quad(Vertex *vertices, float x0, float y0, float x1, float y1, float x2, float y2, float x3, float y3, vec3 color)
+{
+    set_shape_vertex(&vertices[0], x0, y0, color);
+    set_shape_vertex(&vertices[1], x1, y1, color);
+    set_shape_vertex(&vertices[2], x2, y2, color);
+    set_shape_vertex(&vertices[3], x0, y0, color);
+    set_shape_vertex(&vertices[4], x2, y2, color);
+    set_shape_vertex(&vertices[5], x3, y3, color);
+}
+
+void polyline_geometry(size_t count, float width, GLenum *mode, size_t *vertex_count)
+{
+    if (width <= 1.0f)
+    {
+        *mode = GL_LINE_STRIP;
+        *vertex_count = count;
+        return;
+    }
+
+    *mode = GL_TRIANGLES;
+    *vertex_count = count > 1 ? (count - 1) * 6 : 0;
+}
+
+void polyline_build(Vertex *vertices, const float *xs, const float *ys, size_t count, float width, vec3 color)
+{
+    if (width <= 1.0f)
+    {
+        for (size_t i = 0; i < count; ++i)
+            set_shape_vertex(&vertices[i], xs[i], ys[i], color);
+        return;
+    }
+
+    float half_width = width * 0.5f;
+    for (size_t i = 0; i + 1 < count; ++i)
+    {
+        float dx = xs[i + 1] - xs[i];
+        float dy = ys[i + 1] - ys[i];
+        float length = sqrtf(dx * dx + dy * dy);
+        float nx = length > 0.0f ? -dy / length * half_width : 0.0f;
+        float ny = length > 0.0f ? dx / length * half_width : 0.0f;
+
+        set_quad(&vertices[i * 6],
+                 xs[i] + nx, ys[i] + ny,
+                 xs[i + 1] + nx, ys[i + 1] + ny,
+                 xs[i + 1] - nx, ys[i + 1] - ny,
+                 xs[i] - nx, ys[i] - ny,
+                 color);
+    }
+}
+
+void points_geometry(size_t count, float size, GLenum *mode, size_t *vertex_count)
+{
+    if (size <= 1.0f)
+    {
+        *mode = GL_POINTS;
+        *vertex_count = count;
+        return;
+    }
+
+    *mode = GL_TRIANGLES;
+    *vertex_count = count * 6;
+}
+
+void points_build(Vertex *vertices, const float *xs, const float *ys, size_t count, float size, vec3 color)
+{
+    if (size <= 1.0f)
+    {
+        for (size_t i = 0; i < count; ++i)
+            set_shape_vertex(&vertices[i], xs[i], ys[i], color);
+        return;
+    }
+
+    float half_size = size * 0.5f;
+    for (size_t i = 0; i < count; ++i)
+    {
+        float left = xs[i] - half_size, right = xs[i] + half_size;
+        float top = ys[i] - half_size, bottom = ys[i] + half_size;
+        set_quad(&vertices[i * 6], left, top, right, top, right, bottom, left, bottom, color);
+    }
+}
+
+void series_program_init(SeriesProgram *program)
+{
+    program->program = compile_program(series_vertex_shader, series_fragment_shader);
+    program->projection = glGetUniformLocation(program->program, "projection");
+    program->scale = glGetUniformLocation(program->program, "scale");
+    program->offset = glGetUniformLocation(program->program, "offset");
+    program->clip = glGetUniformLocation(program->program, "clip");
+    program->point_size = glGetUniformLocation(program->program, "point_size");
+    program->color = glGetUniformLocation(program->program, "color");
+}
+
+int series_pool_acquire(SeriesPool *pool)
+{
+    for (size_t i = 0; i < pool->count; ++i)
+    {
+        if (!pool->items[i].in_use)
+        {
+            pool->items[i] = (SeriesBuffer){.in_use = true};
+            return (int)i;
+        }
+    }
+
+    SeriesBuffer *items = realloc(pool->items, (pool->count + 1) * sizeof(SeriesBuffer));
+    if (!items)
+    {
+        LOG_ERROR("Failed to allocate plot series.");
+        return -1;
+    }
+
+    pool->items = items;
+    pool->items[pool->count] = (SeriesBuffer){.in_use = true};
+    return (int)pool->count++;
+}
+
+SeriesBuffer *series_pool_get(SeriesPool *pool, int series)
+{
+    if (series < 0 || (size_t)series >= pool->count || !pool->items[series].in_use)
+        return NULL;
+
+    return &pool->items[series];
+}
+
+void series_pool_release(SeriesPool *pool, int series)
+{
+    SeriesBuffer *buffer = series_pool_get(pool, series);
+    if (!buffer)
+        return;
+
+    if (buffer->vbo)
+        glDeleteBuffers(1, &buffer->vbo);
+    *buffer = (SeriesBuffer){0};
+}
+
+void series_pool_free(SeriesPool *pool)
+{
+    for (size_t i = 0; i < pool->count; ++i)
+        series_pool_release(pool, (int)i);
+
+    free(pool->items);
+    *pool = (SeriesPool){0};
+}
+
+bool series_upload(SeriesBuffer *series, const float *xs, const float *ys, size_t offset, size_t count, size_t capacity)
+{
+    if (offset + count > capacity)
+    {
+        LOG_ERROR("Plot series upload out of range.");
+        return false;
+    }
+
+    if (!series->vbo)
+        glGenBuffers(1, &series->vbo);
+
+    glBindBuffer(GL_ARRAY_BUFFER, series->vbo);
+    if (series->capacity != capacity)
+    {
+        glBufferData(GL_ARRAY_BUFFER, 2 * capacity * sizeof(float), NULL, GL_DYNAMIC_DRAW);
+        series->capacity = capacity;
+    }
+
+    if (count)
+    {
+        glBufferSubData(GL_ARRAY_BUFFER, offset * sizeof(float), count * sizeof(float), xs);
+        glBufferSubData(GL_ARRAY_BUFFER, (capacity + offset) * sizeof(float), count * sizeof(float), ys);
+    }
+
+    return true;
+}
+
+void series_draw(const SeriesProgram *program, GLuint vao, const SeriesBuffer *series, size_t first, size_t count,
+                 const GooeyPlotTransform *transform, float point_size, vec3 color, mat4x4 projection)
+{
+    if (!series->vbo || count == 0 || first + count > series->capacity)
+        return;
+
+    glUseProgram(program->program);
+    glUniformMatrix4fv(program->projection, 1, GL_FALSE, (const GLfloat *)projection);
+    glUniform2f(program->scale, transform->scale_x, transform->scale_y);
+    glUniform2f(program->offset, transform->offset_x, transform->offset_y);
+    glUniform4f(program->clip, transform->clip_left, transform->clip_top, transform->clip_right, transform->clip_bottom);
+    glUniform1f(program->point_size, point_size);
+    glUniform3f(program->color, color[0], color[1], color[2]);
+
+    // The axes live in one buffer, so the attribute offsets pick both the axis and the first sample.
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, series->vbo);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 1, GL_FLOAT, GL_FALSE, 0, (void *)(first * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 1, GL_FLOAT, GL_FALSE, 0, (void *)((series->capacity + first) * sizeof(float)));
+
+    if (point_size > 0.0f)
+    {
+        glEnable(GL_PROGRAM_POINT_SIZE);
+        glDrawArrays(GL_POINTS, 0, count);
+        // The shape shader doesn't write gl_PointSize, its points need the fixed size back.
+        glDisable(GL_PROGRAM_POINT_SIZE);
+    }
+    else
+    {
+        glDrawArrays(GL_LINE_STRIP, 0, count);
+    }
+}
+
+void heatmap_program_init(HeatmapProgram *program)
+{
+    program->program = compile_program(heatmap_vertex_shader, heatmap_fragment_shader);
+    program->projection = glGetUniformLocation(program->program, "projection");
+    program->rect = glGetUniformLocation(program->program, "rect");
+    program->row_offset = glGetUniformLocation(program->program, "row_offset");
+    program->range = glGetUniformLocation(program->program, "range");
+
+    glUseProgram(program->program);
+    glUniform1i(glGetUniformLocation(program->program, "values"), 0);
+    glUniform1i(glGetUniformLocation(program->program, "colormap"), 1);
+}
+
+int heatmap_pool_acquire(HeatmapPool *pool)
+{
+    for (size_t i = 0; i < pool->count; ++i)
+    {
+        if (!pool->items[i].in_use)
+        {
+            pool->items[i] = (HeatmapTexture){.in_use = true};
+            return (int)i;
+        }
+    }
+
+    HeatmapTexture *items = realloc(pool->items, (pool->count + 1) * sizeof(HeatmapTexture));
+    if (!items)
+    {
+        LOG_ERROR("Failed to allocate heatmap.");
+        return -1;
+    }
+
+    pool->items = items;
+    pool->items[pool->count] = (HeatmapTexture){.in_use = true};
+    return (int)pool->count++;
+}
+
+HeatmapTexture *heatmap_pool_get(HeatmapPool *pool, int heatmap)
+{
+    if (heatmap < 0 || (size_t)heatmap >= pool->count || !pool->items[heatmap].in_use)
+        return NULL;
+
+    return &pool->items[heatmap];
+}
+
+void heatmap_pool_release(HeatmapPool *pool, int heatmap)
+{
+    HeatmapTexture *texture = heatmap_pool_get(pool, heatmap);
+    if (!texture)
+        return;
+
+    if (texture->values)
+        glDeleteTextures(1, &texture->values);
+    if (texture->colormap)
+        glDeleteTextures(1, &texture->colormap);
+    *texture = (HeatmapTexture){0};
+}
+
+void heatmap_pool_free(HeatmapPool *pool)
+{
+    for (size_t i = 0; i < pool->count; ++i)
+        heatmap_pool_release(pool, (int)i);
+
+    free(pool->items);
+    *pool = (HeatmapPool){0};
 }
-void convert_coords_to_ndc(GLFWwindow *window, float *ndc_x, float *ndc_y, int x, int y)
+
+bool heatmap_upload_rows(HeatmapTexture *heatmap, const float *values, size_t columns, size_t rows, size_t first_row, size_t row_count)
 {
-    int window_width, window_height;
-    get_window_size(window, &window_width, &window_height);
+    if (columns == 0 || rows == 0 || first_row + row_count > rows)
+    {
+        LOG_ERROR("Heatmap upload out of range.");
+        return false;
+    }
+
+    if (!heatmap->values)
+    {
+        glGenTextures(1, &heatmap->values);
+        glBindTexture(GL_TEXTURE_2D, heatmap->values);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        // Scrolling heatmaps are a ring of rows, drawing them starts anywhere and wraps.
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    }
+    else
+    {
+        glBindTexture(GL_TEXTURE_2D, heatmap->values);
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    if (heatmap->columns != columns || heatmap->rows != rows)
+    {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, columns, rows, 0, GL_RED, GL_FLOAT, NULL);
+        heatmap->columns = columns;
+        heatmap->rows = rows;
+    }
+
+    if (row_count)
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, first_row, columns, row_count, GL_RED, GL_FLOAT, values);
+
+    return true;
+}
+
+bool heatmap_upload_colormap(HeatmapTexture *heatmap, const unsigned long *colors, size_t count)
+{
+    if (count == 0)
+        return false;
+
+    unsigned char *texels = malloc(count * 3);
+    if (!texels)
+    {
+        LOG_ERROR("Failed to allocate heatmap colormap.");
+        return false;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        texels[i * 3] = (colors[i] >> 16) & 0xFF;
+        texels[i * 3 + 1] = (colors[i] >> 8) & 0xFF;
+        texels[i * 3 + 2] = colors[i] & 0xFF;
+    }
+
+    if (!heatmap->colormap)
+    {
+        glGenTextures(1, &heatmap->colormap);
+        glBindTexture(GL_TEXTURE_1D, heatmap->colormap);
+        glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    }
+    else
+    {
+        glBindTexture(GL_TEXTURE_1D, heatmap->colormap);
+    }
 
-    *ndc_x = (2.0f * x / window_width) - 1.0f;
-    *ndc_y = 1.0f - (2.0f * y / window_height);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage1D(GL_TEXTURE_1D, 0, GL_RGB8, count, 0, GL_RGB, GL_UNSIGNED_BYTE, texels);
+    free(texels);
+    return true;
 }
 
-void convert_dimension_to_ndc(GLFWwindow *window, float *ndc_w, float *ndc_h, int width, int height)
+void heatmap_draw(const HeatmapProgram *program, GLuint vao, const HeatmapTexture *heatmap, float x, float y, float width, float height,
+                  size_t first_row, float min_value, float max_value, mat4x4 projection)
 {
-    int window_width, window_height;
-    get_window_size(window, &window_width, &window_height);
+    if (!heatmap->values || !heatmap->colormap)
+        return;
+
+    float span = max_value - min_value;
+
+    glUseProgram(program->program);
+    glUniformMatrix4fv(program->projection, 1, GL_FALSE, (const GLfloat *)projection);
+    glUniform4f(program->rect, x, y, width, height);
+    glUniform1f(program->row_offset, (float)(first_row % heatmap->rows) / heatmap->rows);
+    glUniform2f(program->range, min_value, span != 0.0f ? 1.0f / span : 0.0f);
+
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_1D, heatmap->colormap);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, heatmap->values);
+
+    glBindVertexArray(vao);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+}
+
+void marker_program_init(MarkerProgram *program)
+{
+    program->program = compile_program(marker_vertex_shader, marker_fragment_shader);
+    program->projection = glGetUniformLocation(program->program, "projection");
+}
+
+/**
+ * @brief Points a per-marker attribute at `size` bytes of `values` placed at `*offset` in the bound buffer.
+ */
+static void marker_attrib(GLuint location, GLint components, GLenum type, GLboolean normalized, const void *values, size_t size, size_t *offset)
+{
+    glBufferSubData(GL_ARRAY_BUFFER, *offset, size, values);
+    glEnableVertexAttribArray(location);
+    glVertexAttribPointer(location, components, type, normalized, 0, (void *)*offset);
+    glVertexAttribDivisor(location, 1);
+    *offset += size;
+}
+
+void markers_draw(const MarkerProgram *program, GLuint vao, GLuint vbo, const float *xs, const float *ys, size_t count,
+                  const float *sizes, const unsigned char *colors, float size, vec3 color, mat4x4 projection)
+{
+    if (count == 0)
+        return;
+
+    size_t coordinates_size = count * sizeof(float);
+    size_t total_size = 2 * coordinates_size + (sizes ? coordinates_size : 0) + (colors ? count * 4 : 0);
+
+    glUseProgram(program->program);
+    glUniformMatrix4fv(program->projection, 1, GL_FALSE, (const GLfloat *)projection);
+
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    // Orphan the previous frame's markers instead of waiting for the GPU to be done with them.
+    glBufferData(GL_ARRAY_BUFFER, total_size, NULL, GL_STREAM_DRAW);
+
+    size_t offset = 0;
+    marker_attrib(MARKER_ATTRIB_X, 1, GL_FLOAT, GL_FALSE, xs, coordinates_size, &offset);
+    marker_attrib(MARKER_ATTRIB_Y, 1, GL_FLOAT, GL_FALSE, ys, coordinates_size, &offset);
+
+    if (sizes)
+    {
+        marker_attrib(MARKER_ATTRIB_SIZE, 1, GL_FLOAT, GL_FALSE, sizes, coordinates_size, &offset);
+    }
+    else
+    {
+        glDisableVertexAttribArray(MARKER_ATTRIB_SIZE);
+        glVertexAttrib1f(MARKER_ATTRIB_SIZE, size);
+    }
+
+    if (colors)
+    {
+        marker_attrib(MARKER_ATTRIB_COLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE, colors, count * 4, &offset);
+    }
+    else
+    {
+        glDisableVertexAttribArray(MARKER_ATTRIB_COLOR);
+        glVertexAttrib4f(MARKER_ATTRIB_COLOR, color[0], color[1], color[2], 1.0f);
+    }
 
-    *ndc_w= (2.0f * width) / window_width;
-    *ndc_h= -(2.0f * height) / window_height;
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, count);
 }
 
 void convert_hex_to_rgb(vec3 *rgb, unsigned int color_hex)
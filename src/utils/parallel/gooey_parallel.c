@@ -0,0 +1,66 @@
+/*
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "utils/parallel/gooey_parallel_internal.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+size_t GooeyParallel_WorkerCount(size_t count, size_t threshold, size_t min_chunk)
+{
+    if (count < threshold)
+        return 1;
+
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t workers = count / min_chunk;
+
+    if (cpus > 0 && workers > (size_t)cpus)
+        workers = cpus;
+    if (workers > GOOEY_PARALLEL_MAX_WORKERS)
+        workers = GOOEY_PARALLEL_MAX_WORKERS;
+
+    return workers ? workers : 1;
+}
+
+void GooeyParallel_Share(size_t count, size_t worker_count, size_t worker, size_t *begin, size_t *end)
+{
+    size_t chunk = (count + worker_count - 1) / worker_count;
+
+    *begin = worker * chunk < count ? worker * chunk : count;
+    *end = *begin + chunk < count ? *begin + chunk : count;
+}
+
+void GooeyParallel_For(void *jobs, size_t job_size, size_t job_count, void *(*run)(void *))
+{
+    pthread_t threads[GOOEY_PARALLEL_MAX_WORKERS];
+    bool spawned[GOOEY_PARALLEL_MAX_WORKERS] = {false};
+    char *first = jobs;
+
+    // The calling thread takes the first share, and any share a thread couldn't be started for.
+    for (size_t w = 1; w < job_count && w < GOOEY_PARALLEL_MAX_WORKERS; ++w)
+        spawned[w] = pthread_create(&threads[w], NULL, run, first + w * job_size) == 0;
+
+    run(first);
+
+    for (size_t w = 1; w < job_count; ++w)
+    {
+        if (w < GOOEY_PARALLEL_MAX_WORKERS && spawned[w])
+            pthread_join(threads[w], NULL);
+        else
+            run(first + w * job_size);
+    }
+}
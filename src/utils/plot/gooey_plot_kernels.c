@@ -0,0 +1,211 @@
+/*
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "utils/plot/gooey_plot_kernels_internal.h"
+#include <string.h>
+#include <pthread.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* The AVX2 paths are compiled with a target attribute and only run after a CPU check, so the library itself doesn't need -mavx2. */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GOOEY_PLOT_KERNELS_AVX2 1
+#include <immintrin.h>
+#endif
+
+typedef void (*TransformKernel)(const GooeyPlotTransform *, const float *, const float *, size_t, float *, float *, uint8_t *);
+typedef bool (*SortedKernel)(const float *, size_t);
+
+static inline uint8_t clip_code(const GooeyPlotTransform *t, float px, float py)
+{
+    return (px < t->clip_left ? GOOEY_PLOT_CLIP_LEFT : 0) |
+           (px > t->clip_right ? GOOEY_PLOT_CLIP_RIGHT : 0) |
+           (py < t->clip_top ? GOOEY_PLOT_CLIP_TOP : 0) |
+           (py > t->clip_bottom ? GOOEY_PLOT_CLIP_BOTTOM : 0);
+}
+
+static void transform_scalar(const GooeyPlotTransform *t, const float *xs, const float *ys, size_t count,
+                             float *out_x, float *out_y, uint8_t *clip)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        float px = xs[i] * t->scale_x + t->offset_x;
+        float py = ys[i] * t->scale_y + t->offset_y;
+        out_x[i] = px;
+        out_y[i] = py;
+        if (clip)
+            clip[i] = clip_code(t, px, py);
+    }
+}
+
+static bool sorted_scalar(const float *values, size_t count)
+{
+    for (size_t i = 1; i < count; ++i)
+    {
+        if (values[i - 1] > values[i])
+            return false;
+    }
+
+    return true;
+}
+
+#if defined(__SSE2__)
+/**
+ * @brief Outcodes of four points, one 32 bit lane each.
+ */
+static inline __m128i clip_code_sse2(__m128 px, __m128 py, __m128 left, __m128 right, __m128 top, __m128 bottom)
+{
+    __m128i code = _mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(px, left)), _mm_set1_epi32(GOOEY_PLOT_CLIP_LEFT));
+    code = _mm_or_si128(code, _mm_and_si128(_mm_castps_si128(_mm_cmpgt_ps(px, right)), _mm_set1_epi32(GOOEY_PLOT_CLIP_RIGHT)));
+    code = _mm_or_si128(code, _mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(py, top)), _mm_set1_epi32(GOOEY_PLOT_CLIP_TOP)));
+    code = _mm_or_si128(code, _mm_and_si128(_mm_castps_si128(_mm_cmpgt_ps(py, bottom)), _mm_set1_epi32(GOOEY_PLOT_CLIP_BOTTOM)));
+    return code;
+}
+
+static void transform_sse2(const GooeyPlotTransform *t, const float *xs, const float *ys, size_t count,
+                           float *out_x, float *out_y, uint8_t *clip)
+{
+    const __m128 scale_x = _mm_set1_ps(t->scale_x), offset_x = _mm_set1_ps(t->offset_x);
+    const __m128 scale_y = _mm_set1_ps(t->scale_y), offset_y = _mm_set1_ps(t->offset_y);
+    const __m128 left = _mm_set1_ps(t->clip_left), right = _mm_set1_ps(t->clip_right);
+    const __m128 top = _mm_set1_ps(t->clip_top), bottom = _mm_set1_ps(t->clip_bottom);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 px = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(xs + i), scale_x), offset_x);
+        __m128 py = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(ys + i), scale_y), offset_y);
+        _mm_storeu_ps(out_x + i, px);
+        _mm_storeu_ps(out_y + i, py);
+
+        if (clip)
+        {
+            __m128i code = clip_code_sse2(px, py, left, right, top, bottom);
+            code = _mm_packs_epi32(code, code);
+            code = _mm_packus_epi16(code, code);
+            int packed = _mm_cvtsi128_si32(code);
+            memcpy(clip + i, &packed, 4);
+        }
+    }
+
+    transform_scalar(t, xs + i, ys + i, count - i, out_x + i, out_y + i, clip ? clip + i : NULL);
+}
+
+static bool sorted_sse2(const float *values, size_t count)
+{
+    size_t i = 0;
+    for (; i + 5 <= count; i += 4)
+    {
+        // Each value against the next one, NaNs compare false.
+        __m128 descents = _mm_cmpgt_ps(_mm_loadu_ps(values + i), _mm_loadu_ps(values + i + 1));
+        if (_mm_movemask_ps(descents))
+            return false;
+    }
+
+    return sorted_scalar(values + i, count - i);
+}
+#endif
+
+#if defined(GOOEY_PLOT_KERNELS_AVX2)
+__attribute__((target("avx2"))) static void transform_avx2(const GooeyPlotTransform *t, const float *xs, const float *ys, size_t count,
+                                                           float *out_x, float *out_y, uint8_t *clip)
+{
+    const __m256 scale_x = _mm256_set1_ps(t->scale_x), offset_x = _mm256_set1_ps(t->offset_x);
+    const __m256 scale_y = _mm256_set1_ps(t->scale_y), offset_y = _mm256_set1_ps(t->offset_y);
+    const __m256 left = _mm256_set1_ps(t->clip_left), right = _mm256_set1_ps(t->clip_right);
+    const __m256 top = _mm256_set1_ps(t->clip_top), bottom = _mm256_set1_ps(t->clip_bottom);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 px = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(xs + i), scale_x), offset_x);
+        __m256 py = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(ys + i), scale_y), offset_y);
+        _mm256_storeu_ps(out_x + i, px);
+        _mm256_storeu_ps(out_y + i, py);
+
+        if (clip)
+        {
+            __m256i code = _mm256_and_si256(_mm256_castps_si256(_mm256_cmp_ps(px, left, _CMP_LT_OQ)), _mm256_set1_epi32(GOOEY_PLOT_CLIP_LEFT));
+            code = _mm256_or_si256(code, _mm256_and_si256(_mm256_castps_si256(_mm256_cmp_ps(px, right, _CMP_GT_OQ)), _mm256_set1_epi32(GOOEY_PLOT_CLIP_RIGHT)));
+            code = _mm256_or_si256(code, _mm256_and_si256(_mm256_castps_si256(_mm256_cmp_ps(py, top, _CMP_LT_OQ)), _mm256_set1_epi32(GOOEY_PLOT_CLIP_TOP)));
+            code = _mm256_or_si256(code, _mm256_and_si256(_mm256_castps_si256(_mm256_cmp_ps(py, bottom, _CMP_GT_OQ)), _mm256_set1_epi32(GOOEY_PLOT_CLIP_BOTTOM)));
+
+            // Pack the eight 32 bit lanes down to bytes, in order.
+            __m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(code), _mm256_extracti128_si256(code, 1));
+            packed = _mm_packus_epi16(packed, packed);
+            _mm_storel_epi64((__m128i *)(clip + i), packed);
+        }
+    }
+
+    transform_scalar(t, xs + i, ys + i, count - i, out_x + i, out_y + i, clip ? clip + i : NULL);
+}
+
+__attribute__((target("avx2"))) static bool sorted_avx2(const float *values, size_t count)
+{
+    size_t i = 0;
+    for (; i + 9 <= count; i += 8)
+    {
+        __m256 descents = _mm256_cmp_ps(_mm256_loadu_ps(values + i), _mm256_loadu_ps(values + i + 1), _CMP_GT_OQ);
+        if (_mm256_movemask_ps(descents))
+            return false;
+    }
+
+    return sorted_scalar(values + i, count - i);
+}
+#endif
+
+static TransformKernel transform_kernel = NULL;
+static SortedKernel sorted_kernel = NULL;
+
+/** The stats and sort workers call the kernels too, so they're picked exactly once whichever thread comes first. */
+static pthread_once_t kernels_selected = PTHREAD_ONCE_INIT;
+
+static void select_kernels(void)
+{
+#if defined(GOOEY_PLOT_KERNELS_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        transform_kernel = transform_avx2;
+        sorted_kernel = sorted_avx2;
+        return;
+    }
+#endif
+
+#if defined(__SSE2__)
+    transform_kernel = transform_sse2;
+    sorted_kernel = sorted_sse2;
+#else
+    transform_kernel = transform_scalar;
+    sorted_kernel = sorted_scalar;
+#endif
+}
+
+void GooeyPlotKernels_Transform(const GooeyPlotTransform *transform, const float *xs, const float *ys, size_t count,
+                                float *out_x, float *out_y, uint8_t *clip)
+{
+    pthread_once(&kernels_selected, select_kernels);
+    transform_kernel(transform, xs, ys, count, out_x, out_y, clip);
+}
+
+bool GooeyPlotKernels_IsSorted(const float *values, size_t count)
+{
+    pthread_once(&kernels_selected, select_kernels);
+    return sorted_kernel(values, count);
+}
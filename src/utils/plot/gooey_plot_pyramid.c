@@ -0,0 +1,179 @@
+/*
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "utils/plot/gooey_plot_pyramid_internal.h"
+#include "utils/logger/gooey_logger_internal.h"
+#include <math.h>
+#include <stdlib.h>
+
+/** 1 s, 5 s, 15 s, 1 min, 5 min, 15 min, 1 h, 4 h, 1 day, 1 week and 4 weeks, each a multiple of the previous one. */
+static const double bucket_widths[GOOEY_PLOT_PYRAMID_LEVELS] = {
+    1.0, 5.0, 15.0, 60.0, 300.0, 900.0, 3600.0, 14400.0, 86400.0, 604800.0, 2419200.0};
+
+double GooeyPlotPyramid_BucketWidth(size_t level)
+{
+    return bucket_widths[level < GOOEY_PLOT_PYRAMID_LEVELS ? level : GOOEY_PLOT_PYRAMID_LEVELS - 1];
+}
+
+static bool level_reserve(GooeyPlotCandleLevel *level, size_t count)
+{
+    if (count <= level->capacity)
+        return true;
+
+    size_t capacity = level->capacity ? level->capacity : 64;
+    while (capacity < count)
+        capacity *= 2;
+
+    GooeyPlotCandle *candles = realloc(level->candles, capacity * sizeof(GooeyPlotCandle));
+    if (!candles)
+        return false;
+
+    level->candles = candles;
+    level->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Folds a candle, or a single tick when open == high == low == close, into the level's last bucket or a new one.
+ */
+static bool level_merge(GooeyPlotCandleLevel *level, double width, const GooeyPlotCandle *candle)
+{
+    double start = floor(candle->time / width) * width;
+
+    if (level->count && level->candles[level->count - 1].time == start)
+    {
+        GooeyPlotCandle *last = &level->candles[level->count - 1];
+        if (candle->high > last->high)
+            last->high = candle->high;
+        if (candle->low < last->low)
+            last->low = candle->low;
+        last->close = candle->close;
+        return true;
+    }
+
+    if (!level_reserve(level, level->count + 1))
+        return false;
+
+    GooeyPlotCandle *bucket = &level->candles[level->count++];
+    *bucket = *candle;
+    bucket->time = start;
+    return true;
+}
+
+bool GooeyPlotPyramid_Append(GooeyPlotPyramid *pyramid, const double *times, const float *prices, size_t count)
+{
+    GooeyPlotCandleLevel *base = &pyramid->levels[0];
+    size_t base_count = base->count;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!isfinite(times[i]) || !isfinite(prices[i]))
+            continue;
+
+        GooeyPlotCandle tick = {times[i], prices[i], prices[i], prices[i], prices[i]};
+        if (!level_merge(base, bucket_widths[0], &tick))
+        {
+            LOG_ERROR("Failed to allocate memory for plot candles.");
+            return false;
+        }
+
+        pyramid->tick_count++;
+        pyramid->last_time = times[i];
+    }
+
+    if (base->count == 0)
+        return true;
+
+    // The last bucket that existed before may have taken some of the ticks too.
+    size_t changed = base_count ? base_count - 1 : 0;
+
+    for (size_t k = 1; k < GOOEY_PLOT_PYRAMID_LEVELS; ++k)
+    {
+        const GooeyPlotCandleLevel *finer = &pyramid->levels[k - 1];
+        GooeyPlotCandleLevel *level = &pyramid->levels[k];
+        double width = bucket_widths[k];
+
+        // Rebuild every bucket from the one holding the first changed finer candle, at most the last one exists.
+        double start = floor(finer->candles[changed].time / width) * width;
+        while (level->count && level->candles[level->count - 1].time >= start)
+            level->count--;
+
+        size_t first = changed;
+        while (first > 0 && finer->candles[first - 1].time >= start)
+            first--;
+
+        size_t level_count = level->count;
+        for (size_t i = first; i < finer->count; ++i)
+        {
+            if (!level_merge(level, width, &finer->candles[i]))
+            {
+                LOG_ERROR("Failed to allocate memory for plot candles.");
+                return false;
+            }
+        }
+
+        changed = level_count;
+    }
+
+    return true;
+}
+
+size_t GooeyPlotPyramid_PickLevel(double min_width)
+{
+    for (size_t k = 0; k < GOOEY_PLOT_PYRAMID_LEVELS; ++k)
+    {
+        if (bucket_widths[k] >= min_width)
+            return k;
+    }
+
+    return GOOEY_PLOT_PYRAMID_LEVELS - 1;
+}
+
+size_t GooeyPlotPyramid_Find(const GooeyPlotPyramid *pyramid, size_t level, double time)
+{
+    const GooeyPlotCandleLevel *candles = &pyramid->levels[level];
+    double width = bucket_widths[level];
+    size_t low = 0, high = candles->count;
+
+    while (low < high)
+    {
+        size_t mid = low + (high - low) / 2;
+        if (candles->candles[mid].time + width <= time)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return low;
+}
+
+void GooeyPlotPyramid_Clear(GooeyPlotPyramid *pyramid)
+{
+    for (size_t k = 0; k < GOOEY_PLOT_PYRAMID_LEVELS; ++k)
+        pyramid->levels[k].count = 0;
+
+    pyramid->tick_count = 0;
+    pyramid->last_time = 0.0;
+}
+
+void GooeyPlotPyramid_Free(GooeyPlotPyramid *pyramid)
+{
+    for (size_t k = 0; k < GOOEY_PLOT_PYRAMID_LEVELS; ++k)
+        free(pyramid->levels[k].candles);
+
+    *pyramid = (GooeyPlotPyramid){0};
+}
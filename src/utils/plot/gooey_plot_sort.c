@@ -0,0 +1,254 @@
+/*
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "utils/plot/gooey_plot_sort_internal.h"
+#include "utils/parallel/gooey_parallel_internal.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RADIX_BITS 11
+#define RADIX_BUCKETS (1u << RADIX_BITS)
+#define RADIX_MASK (RADIX_BUCKETS - 1)
+
+/** Below this many keys a pass runs on the calling thread only. */
+#define SORT_PARALLEL_THRESHOLD (1 << 20)
+/** Fewest keys worth handing to a thread of their own. */
+#define SORT_MIN_CHUNK (1 << 18)
+
+/* The keys are sorted as the bits of the caller's floats, in place, so they are accessed through a type that may alias them. */
+#if defined(__GNUC__)
+typedef uint32_t __attribute__((__may_alias__)) RadixKey;
+#else
+typedef uint32_t RadixKey;
+#endif
+
+typedef enum
+{
+    SORT_PHASE_FLIP,    /**< Turns the floats into keys that order as unsigned integers, and counts their first digit */
+    SORT_PHASE_COUNT,   /**< Counts the digit of the pass */
+    SORT_PHASE_SCATTER, /**< Moves every key to its slot for the digit of the pass */
+    SORT_PHASE_UNFLIP   /**< Turns the keys back into floats */
+} SORT_PHASE;
+
+/**
+ * @brief What every thread does in the current phase.
+ */
+typedef struct
+{
+    SORT_PHASE phase;
+    unsigned int shift; /**< Position of the digit of the pass */
+    RadixKey *keys;
+    float *values;
+    size_t *order;
+    RadixKey *out_keys;
+    float *out_values;
+    size_t *out_order;
+} SortPass;
+
+/**
+ * @brief One thread's share of the keys, and its count of each digit or, once scattering, the next slot for each.
+ */
+typedef struct
+{
+    const SortPass *pass;
+    size_t begin;
+    size_t end;
+    size_t counts[RADIX_BUCKETS];
+} SortJob;
+
+static inline uint32_t flip_key(uint32_t bits)
+{
+    // Negative floats order backwards, so all their bits flip. Positive ones only need the sign set.
+    uint32_t mask = -(bits >> 31) | 0x80000000u;
+    return bits ^ mask;
+}
+
+static inline uint32_t unflip_key(uint32_t key)
+{
+    uint32_t mask = ((key >> 31) - 1) | 0x80000000u;
+    return key ^ mask;
+}
+
+static void sort_count_range(SortJob *job, bool flip)
+{
+    const SortPass *pass = job->pass;
+    RadixKey *keys = pass->keys;
+
+    memset(job->counts, 0, sizeof(job->counts));
+    for (size_t i = job->begin; i < job->end; ++i)
+    {
+        if (flip)
+            keys[i] = flip_key(keys[i]);
+        job->counts[(keys[i] >> pass->shift) & RADIX_MASK]++;
+    }
+}
+
+static void sort_scatter_range(SortJob *job)
+{
+    const SortPass *pass = job->pass;
+    size_t *slots = job->counts;
+
+    for (size_t i = job->begin; i < job->end; ++i)
+    {
+        uint32_t key = pass->keys[i];
+        size_t slot = slots[(key >> pass->shift) & RADIX_MASK]++;
+
+        pass->out_keys[slot] = key;
+        pass->out_values[slot] = pass->values[i];
+        if (pass->order)
+            pass->out_order[slot] = pass->order[i];
+    }
+}
+
+static void *sort_run(void *arg)
+{
+    SortJob *job = arg;
+
+    switch (job->pass->phase)
+    {
+    case SORT_PHASE_FLIP:
+        sort_count_range(job, true);
+        break;
+    case SORT_PHASE_COUNT:
+        sort_count_range(job, false);
+        break;
+    case SORT_PHASE_SCATTER:
+        sort_scatter_range(job);
+        break;
+    case SORT_PHASE_UNFLIP:
+        for (size_t i = job->begin; i < job->end; ++i)
+            job->pass->keys[i] = unflip_key(job->pass->keys[i]);
+        break;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Runs one phase of a pass over every job's share of the keys.
+ */
+static void sort_run_jobs(SortJob *jobs, size_t worker_count, const SortPass *pass)
+{
+    for (size_t w = 0; w < worker_count; ++w)
+        jobs[w].pass = pass;
+
+    GooeyParallel_For(jobs, sizeof(SortJob), worker_count, sort_run);
+}
+
+/**
+ * @brief Turns every job's digit counts into the slot its first key of each digit goes to.
+ *
+ * Slots of a digit follow the jobs' order, which keeps the sort stable.
+ *
+ * @return false if every key has the same digit, the pass would move nothing then.
+ */
+static bool sort_prepare_slots(SortJob *jobs, size_t worker_count, size_t count)
+{
+    size_t next = 0;
+
+    for (size_t bucket = 0; bucket < RADIX_BUCKETS; ++bucket)
+    {
+        size_t total = 0;
+        for (size_t w = 0; w < worker_count; ++w)
+            total += jobs[w].counts[bucket];
+        if (total == count)
+            return false;
+
+        for (size_t w = 0; w < worker_count; ++w)
+        {
+            size_t bucket_count = jobs[w].counts[bucket];
+            jobs[w].counts[bucket] = next;
+            next += bucket_count;
+        }
+    }
+
+    return true;
+}
+
+bool GooeyPlotSort_ByKey(float *keys, float *values, size_t *order, size_t count)
+{
+    if (count < 2)
+        return true;
+
+    size_t worker_count = GooeyParallel_WorkerCount(count, SORT_PARALLEL_THRESHOLD, SORT_MIN_CHUNK);
+    SortJob *jobs = malloc(worker_count * sizeof(SortJob));
+    RadixKey *scratch_keys = malloc(count * sizeof(RadixKey));
+    float *scratch_values = malloc(count * sizeof(float));
+    size_t *scratch_order = order ? malloc(count * sizeof(size_t)) : NULL;
+
+    if (!jobs || !scratch_keys || !scratch_values || (order && !scratch_order))
+    {
+        free(jobs);
+        free(scratch_keys);
+        free(scratch_values);
+        free(scratch_order);
+        return false;
+    }
+
+    for (size_t w = 0; w < worker_count; ++w)
+        GooeyParallel_Share(count, worker_count, w, &jobs[w].begin, &jobs[w].end);
+
+    RadixKey *key_bits = (RadixKey *)keys;
+    SortPass pass = {.phase = SORT_PHASE_FLIP, .keys = key_bits, .values = values, .order = order,
+                     .out_keys = scratch_keys, .out_values = scratch_values, .out_order = scratch_order};
+    sort_run_jobs(jobs, worker_count, &pass);
+
+    for (pass.shift = 0; pass.shift < 32; pass.shift += RADIX_BITS)
+    {
+        if (pass.shift > 0)
+        {
+            pass.phase = SORT_PHASE_COUNT;
+            sort_run_jobs(jobs, worker_count, &pass);
+        }
+
+        if (!sort_prepare_slots(jobs, worker_count, count))
+            continue;
+
+        pass.phase = SORT_PHASE_SCATTER;
+        sort_run_jobs(jobs, worker_count, &pass);
+
+        // The next pass reads what this one wrote.
+        RadixKey *swap_keys = pass.keys;
+        float *swap_values = pass.values;
+        size_t *swap_order = pass.order;
+        pass.keys = pass.out_keys;
+        pass.values = pass.out_values;
+        pass.order = pass.out_order;
+        pass.out_keys = swap_keys;
+        pass.out_values = swap_values;
+        pass.out_order = swap_order;
+    }
+
+    if (pass.keys != key_bits)
+    {
+        memcpy(key_bits, pass.keys, count * sizeof(RadixKey));
+        memcpy(values, pass.values, count * sizeof(float));
+        if (order)
+            memcpy(order, pass.order, count * sizeof(size_t));
+    }
+
+    pass.phase = SORT_PHASE_UNFLIP;
+    pass.keys = key_bits;
+    sort_run_jobs(jobs, worker_count, &pass);
+
+    free(jobs);
+    free(scratch_keys);
+    free(scratch_values);
+    free(scratch_order);
+    return true;
+}
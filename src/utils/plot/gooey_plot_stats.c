@@ -0,0 +1,399 @@
+/*
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "utils/plot/gooey_plot_stats_internal.h"
+#include "utils/logger/gooey_logger_internal.h"
+#include "utils/parallel/gooey_parallel_internal.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Below this many samples a pass runs on the calling thread only. */
+#define STATS_PARALLEL_THRESHOLD (1 << 18)
+/** Fewest samples worth handing to a thread of their own. */
+#define STATS_MIN_CHUNK (1 << 17)
+
+#define STATS_PI 3.14159265358979323846
+
+/** Half width of the Gaussian kernel, in bandwidths, past which its weight is negligible. */
+#define DENSITY_KERNEL_RADIUS 4.0
+
+typedef enum
+{
+    STATS_PASS_SUMMARY,
+    STATS_PASS_HISTOGRAM,
+    STATS_PASS_LINEAR_BINNING
+} STATS_PASS;
+
+/**
+ * @brief One thread's share of a pass over the samples, and its private results.
+ */
+typedef struct
+{
+    STATS_PASS pass;
+    const float *samples;
+    size_t begin;
+    size_t end;
+
+    float min;     /**< Lower bound of the bins, or the smallest sample seen for a summary */
+    float max;     /**< Upper bound of the bins, or the largest sample seen for a summary */
+    double shift;  /**< Value subtracted before summing, keeps the variance accurate */
+    size_t count;  /**< Finite samples seen */
+    double sum;    /**< Sum of the shifted samples */
+    double sum_sq; /**< Sum of the squared shifted samples */
+
+    size_t bin_count;
+    size_t *bins;     /**< Private histogram bins */
+    double *weights;  /**< Private linear binning weights */
+} StatsJob;
+
+static void stats_summarize_range(StatsJob *job)
+{
+    float min = INFINITY, max = -INFINITY;
+    double sum = 0.0, sum_sq = 0.0;
+    size_t count = 0;
+
+    for (size_t i = job->begin; i < job->end; ++i)
+    {
+        float x = job->samples[i];
+        if (!isfinite(x))
+            continue;
+
+        double d = x - job->shift;
+        sum += d;
+        sum_sq += d * d;
+        count++;
+        if (x < min)
+            min = x;
+        if (x > max)
+            max = x;
+    }
+
+    job->min = min;
+    job->max = max;
+    job->sum = sum;
+    job->sum_sq = sum_sq;
+    job->count = count;
+}
+
+static void stats_histogram_range(StatsJob *job)
+{
+    const float min = job->min, max = job->max;
+    const size_t last = job->bin_count - 1;
+    const float scale = max > min ? job->bin_count / (max - min) : 0.0f;
+    size_t *bins = job->bins;
+
+    for (size_t i = job->begin; i < job->end; ++i)
+    {
+        float x = job->samples[i];
+        // Also rejects NaN.
+        if (!(x >= min && x <= max))
+            continue;
+
+        size_t bin = (size_t)((x - min) * scale);
+        bins[bin < last ? bin : last]++;
+    }
+}
+
+/**
+ * @brief Splits each sample between the two grid points around it, in proportion to how close it is to each.
+ */
+static void stats_linear_binning_range(StatsJob *job)
+{
+    const float min = job->min, max = job->max;
+    const size_t last = job->bin_count - 1;
+    const double scale = last / ((double)max - min);
+    double *weights = job->weights;
+
+    for (size_t i = job->begin; i < job->end; ++i)
+    {
+        float x = job->samples[i];
+        if (!(x >= min && x <= max))
+            continue;
+
+        double position = (x - min) * scale;
+        size_t left = (size_t)position;
+        if (left >= last)
+        {
+            weights[last] += 1.0;
+            continue;
+        }
+
+        double fraction = position - left;
+        weights[left] += 1.0 - fraction;
+        weights[left + 1] += fraction;
+    }
+}
+
+static void *stats_run(void *arg)
+{
+    StatsJob *job = arg;
+
+    switch (job->pass)
+    {
+    case STATS_PASS_SUMMARY:
+        stats_summarize_range(job);
+        break;
+    case STATS_PASS_HISTOGRAM:
+        stats_histogram_range(job);
+        break;
+    case STATS_PASS_LINEAR_BINNING:
+        stats_linear_binning_range(job);
+        break;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Splits [0, count) between `worker_count` jobs set up from `base`, and runs them to completion.
+ */
+static void stats_run_jobs(const StatsJob *base, StatsJob *jobs, size_t worker_count, size_t count)
+{
+    for (size_t w = 0; w < worker_count; ++w)
+    {
+        jobs[w] = *base;
+        GooeyParallel_Share(count, worker_count, w, &jobs[w].begin, &jobs[w].end);
+        if (base->bins)
+            jobs[w].bins = base->bins + w * base->bin_count;
+        if (base->weights)
+            jobs[w].weights = base->weights + w * base->bin_count;
+    }
+
+    GooeyParallel_For(jobs, sizeof(StatsJob), worker_count, stats_run);
+}
+
+bool GooeyPlotStats_Summarize(const float *samples, size_t count, GooeyPlotSummary *summary)
+{
+    StatsJob jobs[GOOEY_PARALLEL_MAX_WORKERS];
+    size_t worker_count = GooeyParallel_WorkerCount(count, STATS_PARALLEL_THRESHOLD, STATS_MIN_CHUNK);
+
+    // Summing around a sample rather than zero keeps the variance from cancelling out.
+    double shift = 0.0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (isfinite(samples[i]))
+        {
+            shift = samples[i];
+            break;
+        }
+    }
+
+    StatsJob base = {.pass = STATS_PASS_SUMMARY, .samples = samples, .shift = shift};
+    stats_run_jobs(&base, jobs, worker_count, count);
+
+    *summary = (GooeyPlotSummary){.min = INFINITY, .max = -INFINITY};
+    double sum = 0.0, sum_sq = 0.0;
+    for (size_t w = 0; w < worker_count; ++w)
+    {
+        summary->count += jobs[w].count;
+        sum += jobs[w].sum;
+        sum_sq += jobs[w].sum_sq;
+        if (jobs[w].min < summary->min)
+            summary->min = jobs[w].min;
+        if (jobs[w].max > summary->max)
+            summary->max = jobs[w].max;
+    }
+
+    if (summary->count)
+    {
+        double mean = sum / summary->count;
+        summary->mean = shift + mean;
+        summary->variance = fmax(sum_sq / summary->count - mean * mean, 0.0);
+    }
+
+    return summary->count > 0;
+}
+
+bool GooeyPlotStats_Histogram(const float *samples, size_t count, float min, float max, size_t *bins, size_t bin_count)
+{
+    if (bin_count == 0)
+        return false;
+
+    size_t worker_count = GooeyParallel_WorkerCount(count, STATS_PARALLEL_THRESHOLD, STATS_MIN_CHUNK);
+    size_t *private_bins = calloc(worker_count * bin_count, sizeof(size_t));
+    if (!private_bins)
+    {
+        LOG_ERROR("Failed to allocate histogram bins.");
+        return false;
+    }
+
+    StatsJob jobs[GOOEY_PARALLEL_MAX_WORKERS];
+    StatsJob base = {.pass = STATS_PASS_HISTOGRAM, .samples = samples, .min = min, .max = max, .bin_count = bin_count, .bins = private_bins};
+    stats_run_jobs(&base, jobs, worker_count, count);
+
+    memcpy(bins, private_bins, bin_count * sizeof(size_t));
+    for (size_t w = 1; w < worker_count; ++w)
+    {
+        const size_t *worker_bins = private_bins + w * bin_count;
+        for (size_t b = 0; b < bin_count; ++b)
+            bins[b] += worker_bins[b];
+    }
+
+    free(private_bins);
+    return true;
+}
+
+/**
+ * @brief In place radix-2 FFT of a complex signal whose length is a power of two.
+ *
+ * @param inverse Computes the inverse transform, scaled by 1 / n.
+ */
+static void stats_fft(double *re, double *im, size_t n, bool inverse)
+{
+    for (size_t i = 1, j = 0; i < n; ++i)
+    {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+
+        if (i < j)
+        {
+            double t = re[i];
+            re[i] = re[j];
+            re[j] = t;
+            t = im[i];
+            im[i] = im[j];
+            im[j] = t;
+        }
+    }
+
+    for (size_t length = 2; length <= n; length <<= 1)
+    {
+        double angle = (inverse ? 2.0 : -2.0) * STATS_PI / length;
+        double step_re = cos(angle), step_im = sin(angle);
+        size_t half = length / 2;
+
+        for (size_t start = 0; start < n; start += length)
+        {
+            double w_re = 1.0, w_im = 0.0;
+            for (size_t k = 0; k < half; ++k)
+            {
+                size_t a = start + k, b = a + half;
+                double t_re = re[b] * w_re - im[b] * w_im;
+                double t_im = re[b] * w_im + im[b] * w_re;
+                re[b] = re[a] - t_re;
+                im[b] = im[a] - t_im;
+                re[a] += t_re;
+                im[a] += t_im;
+
+                double next_re = w_re * step_re - w_im * step_im;
+                w_im = w_re * step_im + w_im * step_re;
+                w_re = next_re;
+            }
+        }
+    }
+
+    if (inverse)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            re[i] /= n;
+            im[i] /= n;
+        }
+    }
+}
+
+bool GooeyPlotStats_Density(const float *samples, size_t count, float min, float max, float bandwidth, float *density, size_t grid_size)
+{
+    if (grid_size < 2 || !(max > min) || !(bandwidth > 0.0f))
+        return false;
+
+    const double delta = ((double)max - min) / (grid_size - 1);
+    double radius = ceil(DENSITY_KERNEL_RADIUS * bandwidth / delta);
+    size_t kernel_half = radius < grid_size - 1 ? (size_t)radius : grid_size - 1;
+
+    // Long enough that the kernel wrapping around the circular convolution never reaches a grid point.
+    size_t fft_size = 1;
+    while (fft_size < grid_size + kernel_half + 1)
+        fft_size <<= 1;
+
+    size_t worker_count = GooeyParallel_WorkerCount(count, STATS_PARALLEL_THRESHOLD, STATS_MIN_CHUNK);
+    double *private_weights = calloc(worker_count * grid_size, sizeof(double));
+    double *buffers = calloc(4 * fft_size, sizeof(double));
+    if (!private_weights || !buffers)
+    {
+        LOG_ERROR("Failed to allocate density estimate buffers.");
+        free(private_weights);
+        free(buffers);
+        return false;
+    }
+
+    StatsJob jobs[GOOEY_PARALLEL_MAX_WORKERS];
+    StatsJob base = {.pass = STATS_PASS_LINEAR_BINNING, .samples = samples, .min = min, .max = max, .bin_count = grid_size, .weights = private_weights};
+    stats_run_jobs(&base, jobs, worker_count, count);
+
+    double *signal_re = buffers, *signal_im = buffers + fft_size;
+    double *kernel_re = buffers + 2 * fft_size, *kernel_im = buffers + 3 * fft_size;
+
+    double total_weight = 0.0;
+    for (size_t w = 0; w < worker_count; ++w)
+    {
+        for (size_t i = 0; i < grid_size; ++i)
+            signal_re[i] += private_weights[w * grid_size + i];
+    }
+    for (size_t i = 0; i < grid_size; ++i)
+        total_weight += signal_re[i];
+
+    // Sampled kernel, normalized so it integrates to 1 on the grid, with negative offsets wrapped to the end.
+    double kernel_sum = 0.0;
+    for (size_t k = 0; k <= kernel_half; ++k)
+    {
+        double u = k * delta / bandwidth;
+        double value = exp(-0.5 * u * u);
+        kernel_re[k] = value;
+        kernel_sum += value;
+        if (k)
+        {
+            kernel_re[fft_size - k] = value;
+            kernel_sum += value;
+        }
+    }
+
+    stats_fft(signal_re, signal_im, fft_size, false);
+    stats_fft(kernel_re, kernel_im, fft_size, false);
+    for (size_t i = 0; i < fft_size; ++i)
+    {
+        double re = signal_re[i] * kernel_re[i] - signal_im[i] * kernel_im[i];
+        double im = signal_re[i] * kernel_im[i] + signal_im[i] * kernel_re[i];
+        signal_re[i] = re;
+        signal_im[i] = im;
+    }
+    stats_fft(signal_re, signal_im, fft_size, true);
+
+    double scale = total_weight > 0.0 ? 1.0 / (total_weight * kernel_sum * delta) : 0.0;
+    for (size_t i = 0; i < grid_size; ++i)
+        density[i] = (float)fmax(signal_re[i] * scale, 0.0);
+
+    free(private_weights);
+    free(buffers);
+    return true;
+}
+
+float GooeyPlotStats_DefaultBandwidth(const GooeyPlotSummary *summary)
+{
+    double sigma = sqrt(summary->variance);
+    if (summary->count < 2 || sigma <= 0.0)
+    {
+        // All samples share one value, any narrow kernel shows that.
+        float magnitude = fabsf(summary->min);
+        return magnitude > 0.0f ? magnitude * 1e-3f : 1e-3f;
+    }
+
+    return (float)(1.06 * sigma * pow((double)summary->count, -0.2));
+}
@@ -26,6 +26,7 @@ void GooeyButton_setText(GooeyButton *button, const char *text)
     }
 
     strcpy(button->label, text);
+    GooeyWidget_MarkDirty(&button->core);
 }
 
 GooeyButton *GooeyButton_Add(GooeyWindow *win, const char *label, int x, int y,
@@ -52,6 +53,7 @@ GooeyButton *GooeyButton_Add(GooeyWindow *win, const char *label, int x, int y,
 void GooeyButton_SetHighlight(GooeyButton *button, bool is_highlighted)
 {
     button->is_highlighted = true;
+    GooeyWidget_MarkDirty(&button->core);
 }
 
 void GooeyButton_Draw(GooeyWindow *win)
@@ -59,6 +61,9 @@ void GooeyButton_Draw(GooeyWindow *win)
     for (int i = 0; i < win->button_count; ++i)
     {
         GooeyButton *button = &win->buttons[i];
+        if (!GooeyWindow_IsDamaged(win, &button->core))
+            continue;
+
         active_backend->FillRectangle(button->core.x,
                                       button->core.y, button->core.width, button->core.height, button->clicked ? active_theme->primary : active_theme->widget_base, win->creation_id);
         float text_width = active_backend->GetTextWidth(button->label, strlen(button->label));
@@ -81,30 +86,35 @@ void GooeyButton_Draw(GooeyWindow *win)
 }
 
 
-bool GooeyButton_HandleClick(GooeyWindow *win, int x, int y)
+bool GooeyButton_HandleClickOn(GooeyWindow *win, GooeyButton *button)
 {
-    bool clicked_any_button = false;
-
-    for (int i = 0; i < win->button_count; ++i)
+    // Only one button per window can be shown pressed, the window remembers which so a click anywhere else releases it.
+    if (win->pressed_button >= 0 && (size_t)win->pressed_button < win->button_count &&
+        &win->buttons[win->pressed_button] != button)
     {
-        GooeyButton *button = &win->buttons[i];
-        bool is_within_bounds = (x >= button->core.x && x <= button->core.x + button->core.width) &&
-                                (y >= button->core.y && y <= button->core.y + button->core.height);
+        win->buttons[win->pressed_button].clicked = false;
+        GooeyWidget_MarkDirty(&win->buttons[win->pressed_button].core);
+        win->pressed_button = -1;
+    }
 
-        if (is_within_bounds)
-        {
-            button->clicked = !button->clicked;
-            clicked_any_button = true;
-            if (button->callback)
-            {
-                button->callback();
-            }
-        }
-        else
-        {
-            button->clicked = false;
-        }
+    if (!button)
+        return false;
+
+    button->clicked = !button->clicked;
+    GooeyWidget_MarkDirty(&button->core);
+
+    win->pressed_button = button->clicked ? (int)(button - win->buttons) : -1;
+
+    if (button->callback)
+    {
+        button->callback();
     }
 
-    return clicked_any_button;
+    return true;
+}
+
+bool GooeyButton_HandleClick(GooeyWindow *win, int x, int y)
+{
+    GooeyWidget *target = GooeyWindow_WidgetAt(win, x, y);
+    return GooeyButton_HandleClickOn(win, target && target->type == WIDGET_BUTTON ? (GooeyButton *)target : NULL);
 }
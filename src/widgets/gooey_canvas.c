@@ -47,6 +47,7 @@ void GooeyCanvas_DrawRectangle(GooeyCanvas *canvas, int x, int y, int width, int
         CanvasDrawRectangleArgs *args = malloc(sizeof(CanvasDrawRectangleArgs));
         *args = (CanvasDrawRectangleArgs){.color = color_hex, .height = height, .width = width, .x = x_win, .y = y_win, .is_filled = is_filled};
         canvas->elements[canvas->element_count++] = (CanvaElement){.operation = CANVA_DRAW_RECT, .args = args};
+        GooeyWidget_MarkDirty(&canvas->core);
         LOG_INFO("Drew %s rectangle with dimensions x=%d, y=%d, w=%d, h=%d in canvas<x=%d, y=%d, w=%d, h=%d>.", is_filled ? "filled" : "hollow", x, y, width, height, canvas->core.x, canvas->core.y, canvas->core.width, canvas->core.height);
     }
     else
@@ -70,6 +71,7 @@ void GooeyCanvas_DrawLine(GooeyCanvas *canvas, int x1, int y1, int x2, int y2, u
         CanvasDrawLineArgs *args = malloc(sizeof(CanvasDrawLineArgs));
         *args = (CanvasDrawLineArgs){.color = color_hex, .x1 = x1_win, .x2 = x2_win, .y1 = y1_win, .y2 = y2_win};
         canvas->elements[canvas->element_count++] = (CanvaElement){.operation = CANVA_DRAW_LINE, .args = args};
+        GooeyWidget_MarkDirty(&canvas->core);
         LOG_INFO("Drew line with dimensions x1=%d, y1=%d, x2=%d, y2=%d", x1, y1, x2, y2);
     }
     else
@@ -89,6 +91,7 @@ void GooeyCanvas_DrawArc(GooeyCanvas *canvas, int x_center, int y_center, int wi
         CanvasDrawArcArgs *args = malloc(sizeof(CanvasDrawArcArgs));
         *args = (CanvasDrawArcArgs){.height = height, .width = width, .x_center = x_win, .y_center = y_win, .angle1 = angle1, .angle2 = angle2};
         canvas->elements[canvas->element_count++] = (CanvaElement){.operation = CANVA_DRAW_ARC, .args = args};
+        GooeyWidget_MarkDirty(&canvas->core);
         LOG_INFO("Drew arc with dimensions x_center=%d, y_center=%d, w=%d, h=%d in Canvas<x=%d, y=%d, w=%d, h=%d>.", x_center, y_center, width, height, canvas->core.x, canvas->core.y, canvas->core.width, canvas->core.height);
     }
     else
@@ -97,6 +100,69 @@ void GooeyCanvas_DrawArc(GooeyCanvas *canvas, int x_center, int y_center, int wi
     }
 }
 
+/**
+ * @brief Copies a batch of points into one allocation, moved to window space.
+ *
+ * @return NULL if a point lies outside the canvas or memory ran out.
+ */
+static CanvasDrawPointsArgs *canvas_copy_points(GooeyCanvas *canvas, const float *xs, const float *ys, size_t count, unsigned long color_hex, float size)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (xs[i] < 0 || xs[i] > canvas->core.width || ys[i] < 0 || ys[i] > canvas->core.height)
+        {
+            LOG_ERROR("Canvas<%d, %d>: Point<%.1f, %.1f> is out of boundaries. will be skipped. \n", canvas->core.x, canvas->core.y, xs[i], ys[i]);
+            return NULL;
+        }
+    }
+
+    CanvasDrawPointsArgs *args = malloc(sizeof(CanvasDrawPointsArgs) + 2 * count * sizeof(float));
+    if (!args)
+    {
+        LOG_ERROR("Failed to allocate canvas points.");
+        return NULL;
+    }
+
+    args->count = count;
+    args->color = color_hex;
+    args->size = size;
+    for (size_t i = 0; i < count; ++i)
+    {
+        args->coords[i] = xs[i] + canvas->core.x;
+        args->coords[count + i] = ys[i] + canvas->core.y;
+    }
+
+    return args;
+}
+
+void GooeyCanvas_DrawPolyline(GooeyCanvas *canvas, const float *xs, const float *ys, size_t count, unsigned long color_hex, float width)
+{
+    if (count < 2)
+        return;
+
+    CanvasDrawPointsArgs *args = canvas_copy_points(canvas, xs, ys, count, color_hex, width);
+    if (!args)
+        return;
+
+    canvas->elements[canvas->element_count++] = (CanvaElement){.operation = CANVA_DRAW_POLYLINE, .args = args};
+    GooeyWidget_MarkDirty(&canvas->core);
+    LOG_INFO("Drew polyline of %zu points in canvas<x=%d, y=%d, w=%d, h=%d>.", count, canvas->core.x, canvas->core.y, canvas->core.width, canvas->core.height);
+}
+
+void GooeyCanvas_DrawPoints(GooeyCanvas *canvas, const float *xs, const float *ys, size_t count, float size, unsigned long color_hex)
+{
+    if (count == 0)
+        return;
+
+    CanvasDrawPointsArgs *args = canvas_copy_points(canvas, xs, ys, count, color_hex, size);
+    if (!args)
+        return;
+
+    canvas->elements[canvas->element_count++] = (CanvaElement){.operation = CANVA_DRAW_POINTS, .args = args};
+    GooeyWidget_MarkDirty(&canvas->core);
+    LOG_INFO("Drew %zu points in canvas<x=%d, y=%d, w=%d, h=%d>.", count, canvas->core.x, canvas->core.y, canvas->core.width, canvas->core.height);
+}
+
 void GooeyCanvas_SetForeground(GooeyCanvas *canvas, unsigned long color_hex)
 {
     CanvasSetFGArgs *args = malloc(sizeof(CanvasSetFGArgs));
@@ -110,6 +176,9 @@ void GooeyCanvas_Draw(GooeyWindow* win) {
 
     for (size_t i = 0; i < win->canvas_count; ++i)
     {
+        if (!GooeyWindow_IsDamaged(win, &win->canvas[i].core))
+            continue;
+
         for (int j = 0; j < win->canvas[i].element_count; ++j)
         {
             CanvaElement *element = &win->canvas[i].elements[j];
@@ -135,6 +204,14 @@ void GooeyCanvas_Draw(GooeyWindow* win) {
                 CanvasSetFGArgs *args_fg = (CanvasSetFGArgs *)element->args;
                 active_backend->SetForeground(args_fg->color);
                 break;
+            case CANVA_DRAW_POLYLINE:
+                CanvasDrawPointsArgs *args_polyline = (CanvasDrawPointsArgs *)element->args;
+                active_backend->DrawPolyline(args_polyline->coords, args_polyline->coords + args_polyline->count, args_polyline->count, args_polyline->color, args_polyline->size, win->creation_id);
+                break;
+            case CANVA_DRAW_POINTS:
+                CanvasDrawPointsArgs *args_points = (CanvasDrawPointsArgs *)element->args;
+                active_backend->DrawPoints(args_points->coords, args_points->coords + args_points->count, args_points->count, args_points->size, args_points->color, win->creation_id);
+                break;
             default:
                 break;
             }
@@ -48,6 +48,8 @@ void GooeyCheckbox_Draw(GooeyWindow *win)
     for (size_t i = 0; i < win->checkbox_count; ++i)
     {
         GooeyCheckbox *checkbox = &win->checkboxes[i];
+        if (!GooeyWindow_IsDamaged(win, &checkbox->core))
+            continue;
 
         int label_width = active_backend->GetTextWidth(checkbox->label, strlen(checkbox->label));
         int label_x = checkbox->core.x + CHECKBOX_SIZE + 10;
@@ -67,20 +69,20 @@ void GooeyCheckbox_Draw(GooeyWindow *win)
     }
 }
 
+bool GooeyCheckbox_HandleClickOn(GooeyCheckbox *checkbox)
+{
+    checkbox->checked = !checkbox->checked;
+    GooeyWidget_MarkDirty(&checkbox->core);
+    if (checkbox->callback)
+        checkbox->callback(checkbox->checked);
+    return true;
+}
+
 bool GooeyCheckbox_HandleClick(GooeyWindow *win, int x, int y)
 {
-    for (size_t i = 0; i < win->checkbox_count; ++i)
-    {
-        GooeyCheckbox *checkbox = &win->checkboxes[i];
-        if (x >= checkbox->core.x && x <= checkbox->core.x + checkbox->core.width &&
-            y >= checkbox->core.y &&
-            y <= checkbox->core.y + checkbox->core.height)
-        {
-            checkbox->checked = !checkbox->checked;
-            if (checkbox->callback)
-                checkbox->callback(checkbox->checked);
-            return true;
-        }
-    }
-    return false;
+    GooeyWidget *target = GooeyWindow_WidgetAt(win, x, y);
+    if (!target || target->type != WIDGET_CHECKBOX)
+        return false;
+
+    return GooeyCheckbox_HandleClickOn((GooeyCheckbox *)target);
 }
@@ -47,6 +47,11 @@ void GooeyDropdown_Draw(GooeyWindow *win) {
         int x_offset = win->dropdowns[i].core.x;
 
         GooeyDropdown *dropdown = &win->dropdowns[i];
+        if (!dropdown->is_open && !GooeyWindow_IsDamaged(win, &dropdown->core))
+        {
+            x_offset += active_backend->GetTextWidth(dropdown->options[dropdown->selected_index], strlen(dropdown->options[dropdown->selected_index])) + 20;
+            continue;
+        }
 
         active_backend->FillRectangle(dropdown->core.x,
                                       dropdown->core.y, dropdown->core.width,
@@ -84,52 +89,53 @@ void GooeyDropdown_Draw(GooeyWindow *win) {
 }
 
 
-bool GooeyDropdown_HandleClick(GooeyWindow *win, int x, int y)
+bool GooeyDropdown_HandleOptionClick(GooeyWindow *win, int x, int y)
 {
-
-    bool _btn_st = false;
     for (size_t i = 0; i < win->dropdown_count; i++)
     {
-        int x_offset = win->dropdowns[i].core.x;
         GooeyDropdown *dropdown = &win->dropdowns[i];
-        int text_width = 10;
-        if (x >= dropdown->core.x && x <= dropdown->core.x + dropdown->core.width && y >= dropdown->core.y && y <= dropdown->core.y + dropdown->core.height)
-        {
-            dropdown->is_open = !dropdown->is_open;
-        GooeyWindow_Redraw(win);
-            _btn_st = true;
-        } 
+        if (!dropdown->is_open)
+            continue;
 
-        if (dropdown->is_open)
-        {
-            int submenu_x = x_offset;
-            int submenu_y = win->dropdowns[i].core.y + win->dropdowns[i].core.height;
-            int submenu_width = win->dropdowns[i].core.width;
-            for (int j = 0; j < dropdown->num_options; j++)
-            {
-                int element_y = submenu_y + (j * 25);
-                if (x >= submenu_x && x <= submenu_x + submenu_width &&
-                    y >= element_y && y <= element_y + 25)
-                {
-                    dropdown->selected_index = j;
+        int submenu_x = dropdown->core.x;
+        int submenu_y = dropdown->core.y + dropdown->core.height;
+        int submenu_width = dropdown->core.width;
+        if (x < submenu_x || x > submenu_x + submenu_width || y < submenu_y || y > submenu_y + dropdown->num_options * 25)
+            continue;
 
-                    if (win->dropdowns[i].callback)
-                        win->dropdowns[i].callback(j);
+        int j = (y - submenu_y) / 25;
+        if (j >= dropdown->num_options)
+            j = dropdown->num_options - 1;
 
-                    dropdown->is_open = 0;
-                    return true;
-                } 
-            }
-        }
+        dropdown->selected_index = j;
 
-        x_offset += text_width + 20;
-    }
-    if (_btn_st)
-    {
+        if (dropdown->callback)
+            dropdown->callback(j);
+
+        dropdown->is_open = 0;
+        GooeyWindow_RequestFullRedraw(win);
         return true;
     }
-    else
-    {
+
+    return false;
+}
+
+bool GooeyDropdown_HandleClickOn(GooeyWindow *win, GooeyDropdown *dropdown)
+{
+    dropdown->is_open = !dropdown->is_open;
+    // The option list overlaps the widgets below it, so opening or closing it repaints everything.
+    GooeyWindow_RequestFullRedraw(win);
+    return true;
+}
+
+bool GooeyDropdown_HandleClick(GooeyWindow *win, int x, int y)
+{
+    if (GooeyDropdown_HandleOptionClick(win, x, y))
+        return true;
+
+    GooeyWidget *target = GooeyWindow_WidgetAt(win, x, y);
+    if (!target || target->type != WIDGET_DROPDOWN)
         return false;
-    }
+
+    return GooeyDropdown_HandleClickOn(win, (GooeyDropdown *)target);
 }
@@ -37,19 +37,25 @@ void GooeyLabel_SetColor(GooeyLabel *label, const char *color)
 {
     unsigned long color_long = (unsigned long)strtol(color, NULL, 0);
     label->color = color_long;
+    GooeyWidget_MarkDirty(&label->core);
 
 }
 
 void GooeyLabel_SetText(GooeyLabel *label, const char *text)
 {
     if (label)
+    {
         strcpy(label->text, text);
+        GooeyWidget_MarkDirty(&label->core);
+    }
 }
 
 void GooeyLabel_Draw(GooeyWindow *win)
 {
     for (size_t i = 0; i < win->label_count; ++i)
     {
+        if (!GooeyWindow_IsDamaged(win, &win->labels[i].core))
+            continue;
 
         active_backend->DrawText(win->labels[i].core.x, win->labels[i].core.y, win->labels[i].text, win->labels[i].color != (unsigned long) -1 ? win->labels[i].color : active_theme->neutral, win->labels[i].font_size, win->creation_id);
     }
@@ -96,6 +96,7 @@ void GooeyLayout_Build(GooeyLayout *layout)
                 widget->width = max_widget_width;
             widget->x = layout->core.x + (layout->core.width - widget->width) / 2;
             widget->y = current_y;
+            GooeyWidget_MarkMoved(widget);
             if (widget->type == WIDGET_LAYOUT)
             {
                 GooeyLayout_Build((GooeyLayout *)widget);
@@ -112,6 +113,7 @@ void GooeyLayout_Build(GooeyLayout *layout)
             widget->width = max_widget_width;
             widget->x = current_x;
             widget->y = layout->core.y + (layout->core.height - widget->height) / 2;
+            GooeyWidget_MarkMoved(widget);
             if (widget->type == WIDGET_LAYOUT)
             {
                 GooeyLayout_Build((GooeyLayout *)widget);
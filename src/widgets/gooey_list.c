@@ -16,21 +16,29 @@
  */
 
 #include "widgets/gooey_list.h"
+#include "utils/parallel/gooey_parallel_internal.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #define DEFAULT_THUMB_WIDTH 10
 #define DEFAULT_ITEM_SPACING 40
 #define DEFAULT_SCROLL_OFFSET 1
 
+#define INITIAL_ITEM_CAPACITY 64
+#define INITIAL_STRINGS_CAPACITY 4096
+
 GooeyList *GooeyList_Add(GooeyWindow *win, int x, int y, int width, int height, void (*callback)(int index))
 {
     GooeyList *list = &win->lists[win->list_count++];
     *list = (GooeyList){0};
 
+    list->core.type = WIDGET_LIST;
     list->core.x = x;
     list->core.y = y;
     list->core.width = width;
     list->core.height = height;
-    list->items = (GooeyListItem *)malloc(sizeof(GooeyListItem) * 1024);
+    list->items = NULL;
     list->item_count = 0;
     list->scroll_offset = DEFAULT_SCROLL_OFFSET;
     list->thumb_y = y;
@@ -44,18 +52,479 @@ GooeyList *GooeyList_Add(GooeyWindow *win, int x, int y, int width, int height,
     return list;
 }
 
+/**
+ * @brief Grows a buffer geometrically until it holds at least `required` elements.
+ */
+static bool list_grow(void **buffer, size_t *capacity, size_t required, size_t element_size, size_t initial_capacity)
+{
+    if (required <= *capacity)
+        return true;
+
+    size_t new_capacity = *capacity ? *capacity : initial_capacity;
+    while (new_capacity < required)
+        new_capacity *= 2;
+
+    void *new_buffer = realloc(*buffer, new_capacity * element_size);
+    if (!new_buffer)
+    {
+        LOG_ERROR("Failed to grow list storage to %zu elements.", new_capacity);
+        return false;
+    }
+
+    *buffer = new_buffer;
+    *capacity = new_capacity;
+    return true;
+}
+
+static bool list_reserve(GooeyList *list, size_t item_count, size_t string_bytes)
+{
+    return list_grow((void **)&list->items, &list->item_capacity, list->item_count + item_count,
+                     sizeof(GooeyListItem), INITIAL_ITEM_CAPACITY) &&
+           list_grow((void **)&list->strings, &list->strings_capacity, list->strings_size + string_bytes,
+                     sizeof(char), INITIAL_STRINGS_CAPACITY);
+}
+
+/**
+ * @brief Copies a string into the arena, which must already have room for it.
+ *
+ * @return Offset of the copy in the arena.
+ */
+static size_t list_store_string(GooeyList *list, const char *text, size_t length)
+{
+    size_t offset = list->strings_size;
+    memcpy(list->strings + offset, text, length);
+    list->strings[offset + length] = '\0';
+    list->strings_size += length + 1;
+    return offset;
+}
+
+/**
+ * @brief Returns the cached row for `index`, asking the provider for it on a miss.
+ *
+ * The least recently used entry is evicted to make room, so the returned row
+ * stays valid until GOOEY_LIST_CACHE_SIZE other rows have been fetched.
+ */
+static const GooeyListItemBuffer *list_cache_fetch(GooeyList *list, size_t index)
+{
+    GooeyListCacheEntry *victim = &list->cache[0];
+    unsigned long now = ++list->cache_clock;
+
+    for (size_t i = 0; i < GOOEY_LIST_CACHE_SIZE; ++i)
+    {
+        GooeyListCacheEntry *entry = &list->cache[i];
+        if (entry->valid && entry->index == index)
+        {
+            entry->last_used = now;
+            return &entry->item;
+        }
+
+        if (victim->valid && (!entry->valid || entry->last_used < victim->last_used))
+            victim = entry;
+    }
+
+    victim->index = index;
+    victim->last_used = now;
+    victim->valid = true;
+    victim->item.title[0] = '\0';
+    victim->item.description[0] = '\0';
+    list->provider(index, &victim->item);
+
+    // Don't trust the provider to terminate what it wrote.
+    victim->item.title[GOOEY_LIST_ITEM_TEXT_SIZE - 1] = '\0';
+    victim->item.description[GOOEY_LIST_ITEM_TEXT_SIZE - 1] = '\0';
+    return &victim->item;
+}
+
+/**
+ * @brief Looks up the text of an item, whether the list stores it or fetches it from its provider.
+ */
+static void list_item_text(GooeyList *list, size_t index, const char **title, const char **description)
+{
+    if (list->provider)
+    {
+        const GooeyListItemBuffer *row = list_cache_fetch(list, index);
+        *title = row->title;
+        *description = row->description;
+        return;
+    }
+
+    const GooeyListItem *item = &list->items[index];
+    *title = list->strings + item->title;
+    *description = list->strings + item->description;
+}
+
+/** Candidate count above which filtering is split across worker threads. */
+#define LIST_FILTER_PARALLEL_THRESHOLD 65536
+/** Smallest share of candidates worth handing to a worker thread. */
+#define LIST_FILTER_MIN_CHUNK 32768
+
+static inline char list_fold_case(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+}
+
+/**
+ * @brief Whether `text` continues with the lowercased `needle`, ignoring ASCII case.
+ *
+ * Stops at the first mismatch, so it never reads past the end of `text`.
+ */
+static bool list_match_at(const char *text, const char *needle, size_t needle_length)
+{
+    for (size_t i = 0; i < needle_length; ++i)
+    {
+        if (list_fold_case(text[i]) != needle[i])
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Case-insensitive substring search of a lowercased needle in an arena string.
+ *
+ * @param limit End of the arena. Strings are packed back to back, so whole
+ *        16 byte blocks can be loaded as long as they end before it.
+ */
+static bool list_text_contains(const char *text, const char *limit, const char *needle, size_t needle_length)
+{
+    const char first = needle[0];
+    const char first_upper = (first >= 'a' && first <= 'z') ? first - ('a' - 'A') : first;
+    const char *cursor = text;
+
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lower = _mm_set1_epi8(first);
+    const __m128i upper = _mm_set1_epi8(first_upper);
+
+    while (cursor + 16 <= limit)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)cursor);
+        unsigned int end_mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, zero));
+        unsigned int candidates = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, lower),
+                                                                 _mm_cmpeq_epi8(block, upper)));
+
+        // Ignore whatever follows the terminator, it belongs to the next string.
+        if (end_mask)
+            candidates &= (end_mask & -end_mask) - 1;
+
+        while (candidates)
+        {
+            if (list_match_at(cursor + __builtin_ctz(candidates), needle, needle_length))
+                return true;
+            candidates &= candidates - 1;
+        }
+
+        if (end_mask)
+            return false;
+
+        cursor += 16;
+    }
+#endif
+
+    for (; *cursor; ++cursor)
+    {
+        if ((*cursor == first || *cursor == first_upper) && list_match_at(cursor, needle, needle_length))
+            return true;
+    }
+
+    return false;
+}
+
+static bool list_text_matches(const GooeyList *list, const char *text)
+{
+    if (list->filter_mode == GOOEY_LIST_FILTER_PREFIX)
+        return list_match_at(text, list->filter, list->filter_length);
+
+    return list_text_contains(text, list->strings + list->strings_size, list->filter, list->filter_length);
+}
+
+static bool list_item_matches(const GooeyList *list, size_t index)
+{
+    const GooeyListItem *item = &list->items[index];
+    return list_text_matches(list, list->strings + item->title) ||
+           list_text_matches(list, list->strings + item->description);
+}
+
+/**
+ * @brief A share of the candidates of a filter pass.
+ */
+typedef struct
+{
+    const GooeyList *list;
+    const size_t *candidates; /**< Item indices to check, NULL to check items [begin, end) directly. */
+    size_t begin;
+    size_t end;
+    size_t *matches; /**< Receives the matching item indices, room for end - begin of them. */
+    size_t match_count;
+} ListFilterJob;
+
+static void *list_filter_run(void *arg)
+{
+    ListFilterJob *job = arg;
+    job->match_count = 0;
+
+    for (size_t i = job->begin; i < job->end; ++i)
+    {
+        size_t index = job->candidates ? job->candidates[i] : i;
+        if (list_item_matches(job->list, index))
+            job->matches[job->match_count++] = index;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Rebuilds the filtered view from a set of candidates using the list's current query.
+ *
+ * @param candidates Item indices that may match, NULL for every item.
+ * @param candidate_count Number of candidates.
+ */
+static bool list_filter_candidates(GooeyList *list, const size_t *candidates, size_t candidate_count)
+{
+    size_t *matches = malloc((candidate_count ? candidate_count : 1) * sizeof(size_t));
+    if (!matches)
+    {
+        LOG_ERROR("Failed to allocate list filter results.");
+        return false;
+    }
+
+    ListFilterJob jobs[GOOEY_PARALLEL_MAX_WORKERS];
+    size_t worker_count = GooeyParallel_WorkerCount(candidate_count, LIST_FILTER_PARALLEL_THRESHOLD, LIST_FILTER_MIN_CHUNK);
+
+    for (size_t w = 0; w < worker_count; ++w)
+    {
+        size_t begin, end;
+        GooeyParallel_Share(candidate_count, worker_count, w, &begin, &end);
+        jobs[w] = (ListFilterJob){.list = list, .candidates = candidates, .begin = begin, .end = end, .matches = matches + begin};
+    }
+
+    GooeyParallel_For(jobs, sizeof(ListFilterJob), worker_count, list_filter_run);
+
+    size_t match_count = jobs[0].match_count;
+    for (size_t w = 1; w < worker_count; ++w)
+    {
+        // Shares are in list order, packing them keeps the view sorted.
+        memmove(matches + match_count, jobs[w].matches, jobs[w].match_count * sizeof(size_t));
+        match_count += jobs[w].match_count;
+    }
+
+    free(list->filtered);
+    list->filtered = matches;
+    list->filtered_count = match_count;
+    list->filtered_capacity = candidate_count ? candidate_count : 1;
+    return true;
+}
+
+/**
+ * @brief Appends items [first, item_count) to the filtered view if they match the current query.
+ */
+static void list_filter_new_items(GooeyList *list, size_t first)
+{
+    if (list->filter_length == 0)
+        return;
+
+    for (size_t i = first; i < list->item_count; ++i)
+    {
+        if (!list_item_matches(list, i))
+            continue;
+
+        if (!list_grow((void **)&list->filtered, &list->filtered_capacity, list->filtered_count + 1,
+                       sizeof(size_t), INITIAL_ITEM_CAPACITY))
+            return;
+
+        list->filtered[list->filtered_count++] = i;
+    }
+}
+
+bool GooeyList_SetFilter(GooeyList *list, const char *query, GOOEY_LIST_FILTER_MODE mode)
+{
+    if (list->provider)
+    {
+        LOG_ERROR("Can't filter a list in data provider mode.");
+        return false;
+    }
+
+    size_t length = query ? strlen(query) : 0;
+    if (length >= GOOEY_LIST_ITEM_TEXT_SIZE)
+    {
+        LOG_ERROR("List filter query is too long.");
+        return false;
+    }
+
+    char folded[GOOEY_LIST_ITEM_TEXT_SIZE];
+    for (size_t i = 0; i < length; ++i)
+        folded[i] = list_fold_case(query[i]);
+    folded[length] = '\0';
+
+    if (length == list->filter_length && mode == list->filter_mode && strcmp(folded, list->filter) == 0)
+        return true;
+
+    // Anything matching the new query also matched the old one when the new query
+    // extends it (or, for substring matching, contains it), so only re-check those.
+    bool refine = list->filter_length > 0 && mode == list->filter_mode &&
+                  (mode == GOOEY_LIST_FILTER_SUBSTRING ? strstr(folded, list->filter) != NULL
+                                                       : strncmp(folded, list->filter, list->filter_length) == 0);
+
+    memcpy(list->filter, folded, length + 1);
+    list->filter_length = length;
+    list->filter_mode = mode;
+    list->scroll_offset = 0;
+    GooeyWidget_MarkDirty(&list->core);
+
+    if (length == 0)
+    {
+        list->filtered_count = 0;
+        return true;
+    }
+
+    bool filtered = refine ? list_filter_candidates(list, list->filtered, list->filtered_count)
+                           : list_filter_candidates(list, NULL, list->item_count);
+    if (!filtered)
+    {
+        // Show everything rather than a stale match set.
+        list->filter[0] = '\0';
+        list->filter_length = 0;
+        list->filtered_count = 0;
+    }
+
+    return filtered;
+}
+
+/**
+ * @brief Number of rows the list shows, the matching items when a filter is set.
+ */
+static inline size_t list_row_count(const GooeyList *list)
+{
+    return list->filter_length ? list->filtered_count : list->item_count;
+}
+
+/**
+ * @brief Index of the item shown on a row.
+ */
+static inline size_t list_row_item(const GooeyList *list, size_t row)
+{
+    return list->filter_length ? list->filtered[row] : row;
+}
+
 void GooeyList_AddItem(GooeyList *list, const char *title, const char *description)
 {
-    GooeyListItem item = {0};
-    strcpy(item.title, title);
-    strcpy(item.description, description);
-    list->items[list->item_count++] = item;
+    const char *titles[] = {title};
+    const char *descriptions[] = {description};
+    GooeyList_AddItems(list, titles, descriptions, 1);
+}
+
+bool GooeyList_AddItems(GooeyList *list, const char *const *titles, const char *const *descriptions, size_t count)
+{
+    if (list->provider)
+    {
+        LOG_ERROR("Can't add items to a list in data provider mode.");
+        return false;
+    }
+
+    if (count == 0)
+        return true;
+
+    size_t string_bytes = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        string_bytes += strlen(titles[i]) + 1;
+        string_bytes += (descriptions && descriptions[i] ? strlen(descriptions[i]) : 0) + 1;
+    }
+
+    if (!list_reserve(list, count, string_bytes))
+        return false;
+
+    size_t first_new = list->item_count;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const char *description = descriptions && descriptions[i] ? descriptions[i] : "";
+        GooeyListItem *item = &list->items[list->item_count++];
+        item->title = list_store_string(list, titles[i], strlen(titles[i]));
+        item->description = list_store_string(list, description, strlen(description));
+    }
+
+    list_filter_new_items(list, first_new);
+    GooeyWidget_MarkDirty(&list->core);
+    return true;
+}
+
+bool GooeyList_SetDataProvider(GooeyList *list, size_t count, GooeyListItemProvider provider)
+{
+    if (!provider)
+    {
+        LOG_ERROR("List data provider can't be NULL.");
+        return false;
+    }
+
+    if (!list->cache)
+    {
+        list->cache = calloc(GOOEY_LIST_CACHE_SIZE, sizeof(GooeyListCacheEntry));
+        if (!list->cache)
+        {
+            LOG_ERROR("Failed to allocate list row cache.");
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < GOOEY_LIST_CACHE_SIZE; ++i)
+        list->cache[i].valid = false;
+
+    // Rows come from the provider from now on, the stored items would only hold on to memory.
+    free(list->items);
+    list->items = NULL;
+    list->item_capacity = 0;
+    free(list->strings);
+    list->strings = NULL;
+    list->strings_capacity = 0;
+    list->strings_size = 0;
+    free(list->filtered);
+    list->filtered = NULL;
+    list->filtered_capacity = 0;
+    list->filter[0] = '\0';
+    list->filter_length = 0;
+    list->filtered_count = 0;
+    list->provider = provider;
+    list->item_count = count;
+    GooeyWidget_MarkDirty(&list->core);
+    return true;
 }
 
 void GooeyList_ClearItems(GooeyList *list)
 {
-    memset(list->items, 0, sizeof(*list->items));
+    // Keep the storage around, lists are usually refilled right away.
+    list->provider = NULL;
     list->item_count = 0;
+    list->strings_size = 0;
+    list->filtered_count = 0;
+    GooeyWidget_MarkDirty(&list->core);
+}
+
+/**
+ * @brief Range of rows [first, last) that can show up in the list's viewport at its current scroll offset.
+ *
+ * Slightly wider than what ends up visible, the draw loop still clips each
+ * title, description and separator on its own.
+ */
+static void list_visible_range(const GooeyList *list, size_t *first, size_t *last)
+{
+    *first = 0;
+    *last = 0;
+
+    size_t row_count = list_row_count(list);
+    if (list->item_spacing <= 0 || row_count == 0)
+        return;
+
+    // Items start 10px below the top edge and scroll_offset is negative once scrolled down.
+    long scrolled = -(long)list->scroll_offset - 10;
+    long first_index = scrolled / list->item_spacing - 1;
+    long last_index = first_index + list->core.height / list->item_spacing + 3;
+
+    if (first_index < 0)
+        first_index = 0;
+    if (last_index < 0)
+        last_index = 0;
+
+    *first = (size_t)first_index < row_count ? (size_t)first_index : row_count;
+    *last = (size_t)last_index < row_count ? (size_t)last_index : row_count;
 }
 
 void GooeyList_Draw(GooeyWindow *win)
@@ -65,6 +534,8 @@ void GooeyList_Draw(GooeyWindow *win)
     for (size_t i = 0; i < win->list_count; ++i)
     {
         GooeyList *list = &win->lists[i];
+        if (!GooeyWindow_IsDamaged(win, &list->core))
+            continue;
 
         active_backend->FillRectangle(
             list->core.x, list->core.y,
@@ -86,7 +557,7 @@ void GooeyList_Draw(GooeyWindow *win)
             list->thumb_width, list->core.height,
             active_theme->neutral, win->creation_id);
 
-        int total_content_height = list->item_count * list->item_spacing;
+        int total_content_height = list_row_count(list) * list->item_spacing;
         int visible_height = list->core.height;
         int max_scroll_offset = (total_content_height > visible_height)
                                     ? total_content_height - visible_height
@@ -111,18 +582,23 @@ void GooeyList_Draw(GooeyWindow *win)
                 active_theme->primary, win->creation_id);
         }
 
-        for (size_t j = 0; j < list->item_count; ++j)
+        size_t first_visible, last_visible;
+        list_visible_range(list, &first_visible, &last_visible);
+        current_y_offset += (int)first_visible * list->item_spacing;
+
+        for (size_t j = first_visible; j < last_visible; ++j)
         {
-            GooeyListItem item = list->items[j];
+            const char *title, *description;
+            list_item_text(list, list_row_item(list, j), &title, &description);
 
-            int title_y = current_y_offset + active_backend->GetTextHeight(item.title, strlen(item.title));
+            int title_y = current_y_offset + active_backend->GetTextHeight(title, strlen(title));
             int description_y = title_y + title_description_spacing;
 
             if (title_y < list->core.y + list->core.height && title_y > list->core.y + 5)
             {
                 active_backend->DrawText(
                     list->core.x + 10, title_y,
-                    item.title, active_theme->neutral,
+                    title, active_theme->neutral,
                     0.25f, win->creation_id);
             }
 
@@ -130,12 +606,12 @@ void GooeyList_Draw(GooeyWindow *win)
             {
                 active_backend->DrawText(
                     list->core.x + 10, description_y,
-                    item.description, active_theme->neutral,
+                    description, active_theme->neutral,
                     0.25f, win->creation_id);
             }
 
             int line_separator_y = current_y_offset + list->item_spacing - 10;
-            if (j < list->item_count - 1 &&
+            if (j < list_row_count(list) - 1 &&
                 line_separator_y < list->core.y + list->core.height - 10 &&
                 line_separator_y > list->core.y + 5)
             {
@@ -155,127 +631,143 @@ void GooeyList_Draw(GooeyWindow *win)
 void GooeyList_ShowSeparator(GooeyList *list, bool state)
 {
     list->show_separator = state;
+    GooeyWidget_MarkDirty(&list->core);
 }
 
 bool GooeyList_HandleScroll(GooeyWindow *window, GooeyEvent *scroll_event)
 {
     const int scroll_speed_multiplier = 2;
 
-    for (size_t i = 0; i < window->list_count; ++i)
-    {
-        GooeyList *list = &window->lists[i];
+    int mouse_x = scroll_event->mouse_move.x;
+    int mouse_y = scroll_event->mouse_move.y;
 
-        int mouse_x = scroll_event->mouse_move.x;
-        int mouse_y = scroll_event->mouse_move.y;
+    GooeyWidget *target = GooeyWindow_WidgetAt(window, mouse_x, mouse_y);
+    if (!target || target->type != WIDGET_LIST)
+        return false;
 
-        int total_content_height = list->item_count * list->item_spacing;
-        int visible_height = list->core.height;
+    GooeyList *list = (GooeyList *)target;
+    int total_content_height = list_row_count(list) * list->item_spacing;
+    int visible_height = list->core.height;
 
-        if (mouse_x >= list->core.x && mouse_x <= list->core.x + list->core.width &&
-            mouse_y >= list->core.y && mouse_y <= list->core.y + list->core.height)
+    if (mouse_x >= list->core.x && mouse_x <= list->core.x + list->core.width &&
+        mouse_y >= list->core.y && mouse_y <= list->core.y + list->core.height)
+    {
+        if (scroll_event->type == GOOEY_EVENT_MOUSE_SCROLL)
         {
-            if (scroll_event->type == GOOEY_EVENT_MOUSE_SCROLL)
-            {
-                int scroll_offset_amount = scroll_event->mouse_scroll.y *
-                                           (total_content_height / visible_height) *
-                                           scroll_speed_multiplier;
-                list->scroll_offset += scroll_offset_amount;
+            int scroll_offset_amount = scroll_event->mouse_scroll.y *
+                                       (total_content_height / visible_height) *
+                                       scroll_speed_multiplier;
+            list->scroll_offset += scroll_offset_amount;
+            GooeyWidget_MarkDirty(&list->core);
 
-                return true;
-            }
-            else if (scroll_event->type == GOOEY_EVENT_KEY_PRESS)
-            {
-                const char *key = active_backend->GetKeyFromCode(scroll_event);
-                LOG_ERROR("%s", key);
+            return true;
+        }
+        else if (scroll_event->type == GOOEY_EVENT_KEY_PRESS)
+        {
+            const char *key = active_backend->GetKeyFromCode(scroll_event);
+            LOG_ERROR("%s", key);
 
-                if (strcmp(key, "Up") == 0)
-                    list->scroll_offset += (total_content_height / visible_height) * scroll_speed_multiplier;
-                else if (strcmp(key, "Down") == 0)
-                    list->scroll_offset -= (total_content_height / visible_height) * scroll_speed_multiplier;
-            }
+            if (strcmp(key, "Up") == 0)
+                list->scroll_offset += (total_content_height / visible_height) * scroll_speed_multiplier;
+            else if (strcmp(key, "Down") == 0)
+                list->scroll_offset -= (total_content_height / visible_height) * scroll_speed_multiplier;
         }
     }
     return false;
 }
 
-bool GooeyList_HandleClick(GooeyWindow *window, int mouse_x, int mouse_y)
+/** List whose thumb is being dragged, if any. */
+static GooeyList *dragging_list = NULL;
+static int mouse_prev = -1;
+
+static bool list_thumb_contains(GooeyList *list, int mouse_x, int mouse_y)
 {
-    for (size_t i = 0; i < window->list_count; ++i)
-    {
-        GooeyList *list = &window->lists[i];
+    int thumb_x = list->core.x + list->core.width;
+    return mouse_x >= thumb_x && mouse_x <= thumb_x + list->thumb_width &&
+           mouse_y >= list->thumb_y && mouse_y <= list->thumb_y + list->thumb_height;
+}
 
-        if (mouse_x >= list->core.x && mouse_x <= list->core.x + list->core.width &&
-            mouse_y >= list->core.y && mouse_y <= list->core.y + list->core.height)
-        {
-            int scroll_offset = list->scroll_offset;
-            int mouse_y_relative = mouse_y - list->core.y;
-            int adjusted_y = mouse_y_relative + scroll_offset;
+static bool list_click_item(GooeyList *list, int mouse_x, int mouse_y)
+{
+    if (mouse_x < list->core.x || mouse_x > list->core.x + list->core.width ||
+        mouse_y < list->core.y || mouse_y > list->core.y + list->core.height)
+        return false;
 
-            if (DEFAULT_ITEM_SPACING <= 0)
-                return false;
+    if (list->item_spacing <= 0)
+        return false;
 
-            int selected_index = adjusted_y / DEFAULT_ITEM_SPACING;
+    // Same layout as GooeyList_Draw: items start 10px below the top edge, scroll_offset is negative once scrolled down.
+    int content_y = mouse_y - list->core.y - list->scroll_offset - 10;
+    if (content_y < 0)
+        return false;
 
-            if (selected_index >= 0 && selected_index < list->item_count)
-            {
-                if (list->callback)
-                {
-                    list->callback(selected_index);
-                }
+    size_t selected_row = content_y / list->item_spacing;
 
-                return true;
-            }
+    if (selected_row < list_row_count(list))
+    {
+        if (list->callback)
+        {
+            list->callback(list_row_item(list, selected_row));
         }
+
+        return true;
     }
 
     return false;
 }
 
+bool GooeyList_HandleClickOn(GooeyList *list, int mouse_x, int mouse_y)
+{
+    if (list_thumb_contains(list, mouse_x, mouse_y))
+    {
+        dragging_list = list;
+        mouse_prev = mouse_y;
+        GooeyWidget_MarkDirty(&list->core);
+        return true;
+    }
+
+    return list_click_item(list, mouse_x, mouse_y);
+}
+
+bool GooeyList_HandleClick(GooeyWindow *window, int mouse_x, int mouse_y)
+{
+    GooeyWidget *target = GooeyWindow_WidgetAt(window, mouse_x, mouse_y);
+    if (!target || target->type != WIDGET_LIST)
+        return false;
+
+    return list_click_item((GooeyList *)target, mouse_x, mouse_y);
+}
+
 bool GooeyList_HandleThumbScroll(GooeyWindow *window, GooeyEvent *scroll_event)
 {
-    static int mouse_prev = -1;
-    static bool is_dragging = false;
+    int mouse_x = scroll_event->mouse_move.x;
+    int mouse_y = scroll_event->mouse_move.y;
 
-    for (size_t i = 0; i < window->list_count; ++i)
+    if (!dragging_list)
     {
-        GooeyList *list = &window->lists[i];
-
-        int mouse_x = scroll_event->mouse_move.x;
-        int mouse_y = scroll_event->mouse_move.y;
+        if (scroll_event->type != GOOEY_EVENT_CLICK_PRESS)
+            return false;
 
-        int thumb_width = list->thumb_width;
-        int thumb_height = list->thumb_height;
-        int thumb_x = list->core.x + list->core.width;
-        int thumb_y = list->thumb_y;
-        int total_content_height = list->item_count * list->item_spacing;
-        int visible_height = list->core.height;
+        GooeyWidget *target = GooeyWindow_WidgetAt(window, mouse_x, mouse_y);
+        if (!target || target->type != WIDGET_LIST || !list_thumb_contains((GooeyList *)target, mouse_x, mouse_y))
+            return false;
 
-        if (mouse_x >= thumb_x && mouse_x <= thumb_x + thumb_width &&
-            mouse_y >= thumb_y && mouse_y <= thumb_y + thumb_height &&
-            scroll_event->type == GOOEY_EVENT_CLICK_PRESS)
-        {
-            is_dragging = true;
-        }
+        return GooeyList_HandleClickOn((GooeyList *)target, mouse_x, mouse_y);
+    }
 
-        if (is_dragging)
-        {
-            active_backend->InhibitResetEvents(1);
-            if (scroll_event->type != GOOEY_EVENT_CLICK_RELEASE)
-            {
-                if (mouse_prev != -1)
-                    list->scroll_offset -= (mouse_y - mouse_prev) * (total_content_height / visible_height);
-                mouse_prev = mouse_y;
-                return true;
-            }
-            else
-            {
-                is_dragging = false;
-                active_backend->InhibitResetEvents(0);
-                mouse_prev = -1;
-            }
-        }
+    if (scroll_event->type == GOOEY_EVENT_CLICK_RELEASE)
+    {
+        dragging_list = NULL;
+        mouse_prev = -1;
+        return false;
     }
 
-    active_backend->InhibitResetEvents(0);
-    return false;
+    GooeyList *list = dragging_list;
+    int total_content_height = list_row_count(list) * list->item_spacing;
+    int visible_height = list->core.height;
+
+    list->scroll_offset -= (mouse_y - mouse_prev) * (total_content_height / visible_height);
+    mouse_prev = mouse_y;
+    GooeyWidget_MarkDirty(&list->core);
+    return true;
 }
\ No newline at end of file
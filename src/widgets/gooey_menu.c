@@ -124,7 +124,8 @@ void GooeyMenu_HandleClick(GooeyWindow *win, int x, int y)
             child->is_open = !child->is_open;
             win->menu->is_busy = !win->menu->is_busy;
 
-            GooeyWindow_Redraw(win);
+            // Submenus overlap the widgets below the bar, so any change repaints the whole window.
+            GooeyWindow_RequestFullRedraw(win);
             return;
         }
 
@@ -151,7 +152,7 @@ void GooeyMenu_HandleClick(GooeyWindow *win, int x, int y)
                     }
                     win->menu->is_busy = 0;
 
-                    GooeyWindow_Redraw(win);
+                    GooeyWindow_RequestFullRedraw(win);
                     return;
                 } else {
                     for (int k = 0; k < win->menu->children_count; k++)
@@ -159,7 +160,7 @@ void GooeyMenu_HandleClick(GooeyWindow *win, int x, int y)
                         win->menu->children[k].is_open = 0;
                         win->menu->is_busy = 0;
                     }
-                    GooeyWindow_Redraw(win);
+                    GooeyWindow_RequestFullRedraw(win);
                     return;
                 }
             }
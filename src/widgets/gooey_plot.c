@@ -16,20 +16,36 @@
  */
 
 #include <widgets/gooey_plot.h>
+#include "utils/plot/gooey_plot_kernels_internal.h"
+#include "utils/plot/gooey_plot_stats_internal.h"
+#include "utils/plot/gooey_plot_sort_internal.h"
 #include <stdint.h>
 #include <math.h>
 #include <float.h>
 #include <stdlib.h>
 #include <string.h>
 
-typedef struct
-{
-    float x;
-    float y;
-} DataPoint;
+/** Marker diameters, in pixels, used when the data has no sizes. */
+#define SCATTER_MARKER_SIZE 6.0f
+#define BUBBLE_MARKER_SIZE 12.0f
+
+/** Pixels a bucket should at least span, for candles and for time series lines. */
+#define CANDLE_PIXELS 4.0f
+#define TIME_SERIES_PIXELS 1.0f
+
+/** Share of a bucket's width a candle body or OHLC tick covers. */
+#define CANDLE_BODY_RATIO 0.7f
 
-static void add_placeholder_point(GooeyPlotData *data)
+/** Fewest pixels between two axis ticks, X labels need more room than Y labels. */
+#define X_TICK_MIN_SPACING 80.0f
+#define Y_TICK_MIN_SPACING 40.0f
+
+/** Most decimals a tick label is printed with. */
+#define TICK_MAX_DECIMALS 6
+
+static void add_placeholder_point(GooeyPlot *plot)
 {
+    GooeyPlotData *data = plot->data;
     if (!data || data->data_count == 0)
     {
         return;
@@ -51,14 +67,53 @@ static void add_placeholder_point(GooeyPlotData *data)
     memcpy(&new_x_data[1], data->x_data, data->data_count * sizeof(float));
     memcpy(&new_y_data[1], data->y_data, data->data_count * sizeof(float));
 
+    // The copies belong to the plot, the caller's arrays are left alone.
+    free(plot->owned_x);
+    free(plot->owned_y);
+    plot->owned_x = new_x_data;
+    plot->owned_y = new_y_data;
+
     data->x_data = new_x_data;
     data->y_data = new_y_data;
     data->data_count += 1;
 }
 
-static int compare_data_points(const void *a, const void *b)
+/**
+ * @brief Reorders the data's marker sizes and colors the way its points were sorted.
+ *
+ * @param order Position before sorting of each point.
+ */
+static void permute_marker_data(GooeyPlotData *data, const size_t *order)
 {
-    return (*(DataPoint *)a).x - (*(DataPoint *)b).x;
+    if (data->size_data)
+    {
+        float *sizes = malloc(data->data_count * sizeof(float));
+        if (!sizes)
+        {
+            LOG_ERROR("Failed to allocate memory for sorting.");
+            return;
+        }
+
+        for (size_t i = 0; i < data->data_count; ++i)
+            sizes[i] = data->size_data[order[i]];
+        memcpy(data->size_data, sizes, data->data_count * sizeof(float));
+        free(sizes);
+    }
+
+    if (data->color_data)
+    {
+        unsigned long *colors = malloc(data->data_count * sizeof(unsigned long));
+        if (!colors)
+        {
+            LOG_ERROR("Failed to allocate memory for sorting.");
+            return;
+        }
+
+        for (size_t i = 0; i < data->data_count; ++i)
+            colors[i] = data->color_data[order[i]];
+        memcpy(data->color_data, colors, data->data_count * sizeof(unsigned long));
+        free(colors);
+    }
 }
 
 static void sort_data(GooeyPlotData *data)
@@ -68,28 +123,34 @@ static void sort_data(GooeyPlotData *data)
         return;
     }
 
-    DataPoint *points = malloc(data->data_count * sizeof(DataPoint));
-    if (!points)
-    {
-        LOG_ERROR("Failed to allocate memory for sorting.");
+    // Data usually comes in order already, which a single pass tells.
+    if (GooeyPlotKernels_IsSorted(data->x_data, data->data_count))
         return;
-    }
 
-    for (size_t i = 0; i < data->data_count; ++i)
+    size_t *order = NULL;
+    if (data->size_data || data->color_data)
     {
-        points[i].x = data->x_data[i];
-        points[i].y = data->y_data[i];
-    }
+        order = malloc(data->data_count * sizeof(size_t));
+        if (!order)
+        {
+            LOG_ERROR("Failed to allocate memory for sorting.");
+            return;
+        }
 
-    qsort(points, data->data_count, sizeof(DataPoint), compare_data_points);
+        for (size_t i = 0; i < data->data_count; ++i)
+            order[i] = i;
+    }
 
-    for (size_t i = 0; i < data->data_count; ++i)
+    if (!GooeyPlotSort_ByKey(data->x_data, data->y_data, order, data->data_count))
     {
-        data->x_data[i] = points[i].x;
-        data->y_data[i] = points[i].y;
+        LOG_ERROR("Failed to allocate memory for sorting.");
+        free(order);
+        return;
     }
 
-    free(points);
+    if (order)
+        permute_marker_data(data, order);
+    free(order);
 }
 
 static void calculate_min_max_values(GooeyPlotData *data)
@@ -116,6 +177,830 @@ static void calculate_min_max_values(GooeyPlotData *data)
     }
 }
 
+static bool plot_reserve_decimated(GooeyPlot *plot, size_t count)
+{
+    if (count <= plot->decimated_capacity)
+        return true;
+
+    float *new_x = realloc(plot->decimated_x, count * sizeof(float));
+    if (!new_x)
+    {
+        LOG_ERROR("Failed to allocate memory for decimated plot data.");
+        return false;
+    }
+    plot->decimated_x = new_x;
+
+    float *new_y = realloc(plot->decimated_y, count * sizeof(float));
+    if (!new_y)
+    {
+        LOG_ERROR("Failed to allocate memory for decimated plot data.");
+        return false;
+    }
+    plot->decimated_y = new_y;
+
+    plot->decimated_capacity = count;
+    return true;
+}
+
+static void push_decimated(GooeyPlot *plot, size_t index)
+{
+    plot->decimated_x[plot->decimated_count] = plot->data->x_data[index];
+    plot->decimated_y[plot->decimated_count] = plot->data->y_data[index];
+    plot->decimated_count++;
+}
+
+/**
+ * @brief M4 decimation: keeps the first, minimum, maximum and last sample of every pixel column, in x order.
+ *
+ * Relies on the samples being sorted by x.
+ */
+static bool decimate_m4(GooeyPlot *plot, size_t columns)
+{
+    const GooeyPlotData *data = plot->data;
+    if (!plot_reserve_decimated(plot, columns * 4))
+        return false;
+
+    float x_first = data->x_data[0];
+    float x_range = data->x_data[data->data_count - 1] - x_first;
+    float scale = x_range > 0 ? columns / x_range : 0;
+
+    plot->decimated_count = 0;
+    size_t j = 0;
+    while (j < data->data_count)
+    {
+        size_t column = (size_t)((data->x_data[j] - x_first) * scale);
+        if (column >= columns)
+            column = columns - 1;
+
+        size_t first = j, min_index = j, max_index = j;
+        for (++j; j < data->data_count; ++j)
+        {
+            size_t next_column = (size_t)((data->x_data[j] - x_first) * scale);
+            if (next_column > column && column != columns - 1)
+                break;
+
+            if (data->y_data[j] < data->y_data[min_index])
+                min_index = j;
+            if (data->y_data[j] > data->y_data[max_index])
+                max_index = j;
+        }
+        size_t last = j - 1;
+
+        size_t picks[4] = {first, min_index < max_index ? min_index : max_index,
+                           min_index < max_index ? max_index : min_index, last};
+        for (size_t k = 0; k < 4; ++k)
+        {
+            if (k == 0 || picks[k] != picks[k - 1])
+                push_decimated(plot, picks[k]);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Largest-Triangle-Three-Buckets decimation down to `threshold` samples.
+ *
+ * Keeps the first and last samples, then from each bucket the sample forming
+ * the largest triangle with the previously kept one and the next bucket's average.
+ */
+static bool decimate_lttb(GooeyPlot *plot, size_t threshold)
+{
+    const GooeyPlotData *data = plot->data;
+    const float *xs = data->x_data;
+    const float *ys = data->y_data;
+    size_t count = data->data_count;
+
+    if (!plot_reserve_decimated(plot, threshold))
+        return false;
+
+    plot->decimated_count = 0;
+    push_decimated(plot, 0);
+
+    double bucket_size = (double)(count - 2) / (threshold - 2);
+    size_t previous = 0;
+
+    for (size_t bucket = 0; bucket < threshold - 2; ++bucket)
+    {
+        size_t start = (size_t)(bucket * bucket_size) + 1;
+        size_t end = (size_t)((bucket + 1) * bucket_size) + 1;
+        size_t next_start = end;
+        size_t next_end = (size_t)((bucket + 2) * bucket_size) + 1;
+        if (next_end > count)
+            next_end = count;
+
+        double average_x = 0, average_y = 0;
+        for (size_t j = next_start; j < next_end; ++j)
+        {
+            average_x += xs[j];
+            average_y += ys[j];
+        }
+        if (next_end > next_start)
+        {
+            average_x /= next_end - next_start;
+            average_y /= next_end - next_start;
+        }
+        else
+        {
+            average_x = xs[count - 1];
+            average_y = ys[count - 1];
+        }
+
+        double max_area = -1;
+        size_t picked = start;
+        for (size_t j = start; j < end; ++j)
+        {
+            double area = fabs((xs[previous] - average_x) * (ys[j] - ys[previous]) -
+                               (xs[previous] - xs[j]) * (average_y - ys[previous]));
+            if (area > max_area)
+            {
+                max_area = area;
+                picked = j;
+            }
+        }
+
+        push_decimated(plot, picked);
+        previous = picked;
+    }
+
+    push_decimated(plot, count - 1);
+    return true;
+}
+
+/**
+ * @brief Samples to draw for a line plot spanning `columns` pixel columns.
+ *
+ * Decimated samples are cached until the data, the column count or the
+ * decimation mode changes. Falls back to the raw samples when there are few
+ * enough of them or decimation fails.
+ */
+static void prepare_line_samples(GooeyPlot *plot, size_t columns, const float **xs, const float **ys, size_t *count)
+{
+    const GooeyPlotData *data = plot->data;
+    *xs = data->x_data;
+    *ys = data->y_data;
+    *count = data->data_count;
+
+    if (columns == 0 || plot->decimation == GOOEY_PLOT_DECIMATION_NONE)
+        return;
+
+    size_t threshold = plot->decimation == GOOEY_PLOT_DECIMATION_M4 ? columns * 4 : columns;
+    if (threshold < 3 || data->data_count <= threshold)
+        return;
+
+    bool cached = plot->decimated_generation == plot->data_generation &&
+                  plot->decimated_columns == (int)columns &&
+                  plot->decimated_mode == plot->decimation;
+
+    if (!cached)
+    {
+        bool decimated = plot->decimation == GOOEY_PLOT_DECIMATION_M4 ? decimate_m4(plot, columns)
+                                                                      : decimate_lttb(plot, threshold);
+        if (!decimated)
+            return;
+
+        plot->decimated_generation = plot->data_generation;
+        plot->decimated_columns = (int)columns;
+        plot->decimated_mode = plot->decimation;
+    }
+
+    *xs = plot->decimated_x;
+    *ys = plot->decimated_y;
+    *count = plot->decimated_count;
+}
+
+/**
+ * @brief Drops entries that left the window from the front, then pushes `seq` at the back.
+ *
+ * Entries the new sample makes irrelevant are popped from the back first, so
+ * the front always holds the window's minimum (or maximum).
+ */
+static void stream_deque_push(GooeyPlotDeque *deque, const GooeyPlotStream *stream, size_t seq, size_t first, bool track_min)
+{
+    const size_t capacity = stream->capacity;
+
+    while (deque->count && deque->items[deque->head] < first)
+    {
+        deque->head = (deque->head + 1) % capacity;
+        deque->count--;
+    }
+
+    float y = stream->y[seq % capacity];
+    while (deque->count)
+    {
+        float back_y = stream->y[deque->items[(deque->head + deque->count - 1) % capacity] % capacity];
+        if (track_min ? back_y < y : back_y > y)
+            break;
+        deque->count--;
+    }
+
+    deque->items[(deque->head + deque->count) % capacity] = seq;
+    deque->count++;
+}
+
+static void stream_push(GooeyPlotStream *stream, float x, float y)
+{
+    size_t seq = stream->total++;
+    size_t slot = seq % stream->capacity;
+
+    stream->x[slot] = stream->x[slot + stream->capacity] = x;
+    stream->y[slot] = stream->y[slot + stream->capacity] = y;
+
+    size_t first = stream->total > stream->capacity ? stream->total - stream->capacity : 0;
+    stream_deque_push(&stream->min_y, stream, seq, first, true);
+    stream_deque_push(&stream->max_y, stream, seq, first, false);
+}
+
+/**
+ * @brief Points the plot's data at the stream window and refreshes its bounds.
+ */
+static void stream_sync_data(GooeyPlot *plot)
+{
+    GooeyPlotStream *stream = &plot->stream;
+    GooeyPlotData *data = plot->data;
+
+    size_t first = stream->total > stream->capacity ? stream->total - stream->capacity : 0;
+    data->x_data = stream->x + first % stream->capacity;
+    data->y_data = stream->y + first % stream->capacity;
+    data->data_count = stream->total - first;
+
+    if (data->data_count)
+    {
+        // Samples are appended in x order, so the window's x bounds are its ends.
+        data->min_x_value = data->x_data[0];
+        data->max_x_value = data->x_data[data->data_count - 1];
+        data->min_y_value = stream->y[stream->min_y.items[stream->min_y.head] % stream->capacity];
+        data->max_y_value = stream->y[stream->max_y.items[stream->max_y.head] % stream->capacity];
+    }
+
+    plot->data_generation++;
+    GooeyWidget_MarkDirty(&plot->core);
+}
+
+static void stream_free(GooeyPlotStream *stream)
+{
+    free(stream->x);
+    free(stream->y);
+    free(stream->min_y.items);
+    free(stream->max_y.items);
+    *stream = (GooeyPlotStream){0};
+}
+
+/**
+ * @brief Replaces the plot's stream with one of `capacity` samples, seeded with the newest samples of its data.
+ */
+static bool stream_init(GooeyPlot *plot, size_t capacity)
+{
+    GooeyPlotStream stream = {0};
+    stream.capacity = capacity;
+    stream.x = malloc(2 * capacity * sizeof(float));
+    stream.y = malloc(2 * capacity * sizeof(float));
+    stream.min_y.items = malloc(capacity * sizeof(size_t));
+    stream.max_y.items = malloc(capacity * sizeof(size_t));
+
+    if (!stream.x || !stream.y || !stream.min_y.items || !stream.max_y.items)
+    {
+        LOG_ERROR("Failed to allocate memory for plot stream.");
+        stream_free(&stream);
+        return false;
+    }
+
+    const GooeyPlotData *data = plot->data;
+    if (data->x_data && data->y_data)
+    {
+        // Leave out the placeholder point GooeyPlot_Add put in front of the data.
+        size_t first = (plot->owned_x && data->x_data == plot->owned_x) ? 1 : 0;
+        if (data->data_count > first + capacity)
+            first = data->data_count - capacity;
+
+        for (size_t i = first; i < data->data_count; ++i)
+            stream_push(&stream, data->x_data[i], data->y_data[i]);
+    }
+
+    // Only now, the data may still have pointed into the previous stream.
+    stream_free(&plot->stream);
+    plot->stream = stream;
+    plot->gpu.valid = false;
+    stream_sync_data(plot);
+    return true;
+}
+
+/**
+ * @brief Whether the plot's samples are drawn from a backend series.
+ */
+static bool plot_uses_gpu(const GooeyPlot *plot)
+{
+    const GooeyPlotData *data = plot->data;
+
+    // Series only hold positions, markers with their own size or color are drawn from the layout.
+    return plot->render_mode == GOOEY_PLOT_RENDER_GPU &&
+           (data->plot_type == GOOEY_PLOT_LINE ||
+            (data->plot_type == GOOEY_PLOT_SCATTER && !data->size_data && !data->color_data));
+}
+
+/**
+ * @brief Whether each sample is drawn as a marker of its own.
+ */
+static bool plot_draws_markers(const GooeyPlotData *data)
+{
+    return data->plot_type == GOOEY_PLOT_SCATTER || data->plot_type == GOOEY_PLOT_BUBBLE;
+}
+
+/**
+ * @brief Whether the data's marker sizes and colors line up with its samples.
+ *
+ * Streamed samples carry positions only.
+ */
+static bool plot_has_marker_data(const GooeyPlot *plot)
+{
+    return plot->stream.capacity == 0 && (plot->data->size_data || plot->data->color_data);
+}
+
+static void gpu_series_release(GooeyPlot *plot)
+{
+    if (plot->gpu.allocated && active_backend->DestroySeries)
+        active_backend->DestroySeries(plot->gpu.series);
+    plot->gpu = (GooeyPlotGpuSeries){0};
+}
+
+/**
+ * @brief Uploads stream slots [slot, slot + count) and their mirror, wrapping around the ring.
+ */
+static bool gpu_series_upload_slots(GooeyPlot *plot, GooeyWindow *win, size_t slot, size_t count)
+{
+    const GooeyPlotStream *stream = &plot->stream;
+    const size_t capacity = stream->capacity;
+    const int series = plot->gpu.series;
+
+    while (count)
+    {
+        size_t run = count < capacity - slot ? count : capacity - slot;
+        if (!active_backend->UploadSeries(series, stream->x + slot, stream->y + slot, slot, run, 2 * capacity, win->creation_id) ||
+            !active_backend->UploadSeries(series, stream->x + slot + capacity, stream->y + slot + capacity, slot + capacity, run, 2 * capacity, win->creation_id))
+            return false;
+
+        count -= run;
+        slot = 0;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Brings the plot's backend series up to date with its data.
+ *
+ * @return false if the backend has no series or the upload failed.
+ */
+static bool gpu_series_sync(GooeyPlot *plot, GooeyWindow *win)
+{
+    GooeyPlotGpuSeries *gpu = &plot->gpu;
+    const GooeyPlotStream *stream = &plot->stream;
+    const GooeyPlotData *data = plot->data;
+
+    if (!active_backend->CreateSeries || !active_backend->UploadSeries || !active_backend->DrawSeries)
+        return false;
+
+    if (!gpu->allocated)
+    {
+        int series = active_backend->CreateSeries();
+        if (series < 0)
+            return false;
+
+        *gpu = (GooeyPlotGpuSeries){.allocated = true, .series = series};
+    }
+
+    if (stream->capacity)
+    {
+        // The series keeps the stream's mirrored layout, so the window is always one contiguous range.
+        const size_t capacity = 2 * stream->capacity;
+        if (gpu->valid && gpu->streamed && gpu->capacity == capacity &&
+            gpu->stream_total <= stream->total && stream->total - gpu->stream_total < stream->capacity)
+        {
+            if (!gpu_series_upload_slots(plot, win, gpu->stream_total % stream->capacity, stream->total - gpu->stream_total))
+            {
+                gpu->valid = false;
+                return false;
+            }
+        }
+        else
+        {
+            gpu->valid = false;
+            if (!active_backend->UploadSeries(gpu->series, stream->x, stream->y, 0, capacity, capacity, win->creation_id))
+                return false;
+        }
+
+        gpu->streamed = true;
+        gpu->capacity = capacity;
+        gpu->stream_total = stream->total;
+        gpu->valid = true;
+        return true;
+    }
+
+    if (gpu->valid && !gpu->streamed && gpu->data_generation == plot->data_generation)
+        return true;
+
+    gpu->valid = false;
+    if (!active_backend->UploadSeries(gpu->series, data->x_data, data->y_data, 0, data->data_count, data->data_count, win->creation_id))
+        return false;
+
+    gpu->streamed = false;
+    gpu->capacity = data->data_count;
+    gpu->data_generation = plot->data_generation;
+    gpu->valid = true;
+    return true;
+}
+
+/** Default heatmap colormap, perceptually uniform from dark blue through green to yellow. */
+static const unsigned long default_heatmap_colormap[] = {
+    0x440154, 0x46327e, 0x365c8d, 0x277f8e, 0x1fa187, 0x4ac16d, 0xa0da39, 0xfde725};
+
+static bool heatmap_supported(void)
+{
+    return active_backend->CreateHeatmap && active_backend->UploadHeatmapRows &&
+           active_backend->UploadHeatmapColormap && active_backend->DrawHeatmap;
+}
+
+static bool plot_is_heatmap(const GooeyPlot *plot)
+{
+    if (!plot || !plot->data || plot->data->plot_type != GOOEY_PLOT_HEATMAP)
+    {
+        LOG_ERROR("Invalid heatmap plot provided.");
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Copies `count` rows into the ring, starting `first_row` rows above the bottom one.
+ */
+static void heatmap_write_rows(GooeyPlot *plot, size_t first_row, const float *values, size_t count)
+{
+    GooeyPlotHeatmap *heatmap = &plot->heatmap;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t row = (heatmap->head + first_row + i) % heatmap->rows;
+        memcpy(heatmap->values + row * heatmap->columns, values + i * heatmap->columns, heatmap->columns * sizeof(float));
+        heatmap->dirty_rows[row] = 1;
+    }
+
+    heatmap->dirty = true;
+    GooeyWidget_MarkDirty(&plot->core);
+}
+
+/**
+ * @brief Uploads the colormap if it changed and every run of dirty rows with one call each.
+ */
+static bool heatmap_sync(GooeyPlot *plot, GooeyWindow *win)
+{
+    GooeyPlotHeatmap *heatmap = &plot->heatmap;
+
+    if (!heatmap_supported())
+        return false;
+
+    if (!heatmap->allocated)
+    {
+        int texture = active_backend->CreateHeatmap();
+        if (texture < 0)
+            return false;
+
+        heatmap->allocated = true;
+        heatmap->texture = texture;
+        heatmap->colormap_dirty = true;
+        heatmap->dirty = true;
+        memset(heatmap->dirty_rows, 1, heatmap->rows);
+    }
+
+    if (heatmap->colormap_dirty)
+    {
+        if (!active_backend->UploadHeatmapColormap(heatmap->texture, heatmap->colormap, heatmap->colormap_count, win->creation_id))
+            return false;
+        heatmap->colormap_dirty = false;
+    }
+
+    if (!heatmap->dirty)
+        return true;
+
+    size_t row = 0;
+    while (row < heatmap->rows)
+    {
+        if (!heatmap->dirty_rows[row])
+        {
+            ++row;
+            continue;
+        }
+
+        size_t end = row;
+        while (end < heatmap->rows && heatmap->dirty_rows[end])
+            ++end;
+
+        if (!active_backend->UploadHeatmapRows(heatmap->texture, heatmap->values + row * heatmap->columns,
+                                               heatmap->columns, heatmap->rows, row, end - row, win->creation_id))
+            return false;
+
+        memset(heatmap->dirty_rows + row, 0, end - row);
+        row = end;
+    }
+
+    heatmap->dirty = false;
+    return true;
+}
+
+/**
+ * @brief Whether the plot's samples are raw values binned or estimated into a distribution before drawing.
+ */
+static bool plot_is_distribution(const GooeyPlotData *data)
+{
+    return data->plot_type == GOOEY_PLOT_HISTOGRAM || data->plot_type == GOOEY_PLOT_DENSITY;
+}
+
+/**
+ * @brief Whether the plot's samples are ticks drawn through the candle pyramid.
+ */
+static bool plot_is_aggregated(const GooeyPlotData *data)
+{
+    return data->plot_type == GOOEY_PLOT_CANDLESTICK || data->plot_type == GOOEY_PLOT_OHLC ||
+           data->plot_type == GOOEY_PLOT_TIME_SERIES;
+}
+
+static bool plot_has_data(const GooeyPlot *plot)
+{
+    const GooeyPlotData *data = plot->data;
+
+    if (data->plot_type == GOOEY_PLOT_HEATMAP)
+        return plot->heatmap.values;
+
+    if (plot_is_aggregated(data) && plot->candles.pyramid.tick_count)
+        return true;
+
+    // Distributions are computed from x values alone.
+    return data->x_data && (data->y_data || plot_is_distribution(data)) && data->data_count > 0;
+}
+
+static bool distribution_reserve(GooeyPlotDistribution *distribution, size_t count)
+{
+    if (count <= distribution->capacity)
+        return true;
+
+    float *x = realloc(distribution->x, count * sizeof(float));
+    if (!x)
+        return false;
+    distribution->x = x;
+
+    float *y = realloc(distribution->y, count * sizeof(float));
+    if (!y)
+        return false;
+    distribution->y = y;
+
+    distribution->capacity = count;
+    return true;
+}
+
+/**
+ * @brief Bins the plot's samples, or estimates their density, and fits the axes to the result.
+ *
+ * Nothing is computed while the data generation and bin count stay the same.
+ *
+ * @return false if the distribution couldn't be computed, the plot is skipped then.
+ */
+static bool prepare_distribution(GooeyPlot *plot)
+{
+    GooeyPlotDistribution *distribution = &plot->distribution;
+    GooeyPlotData *data = plot->data;
+    bool histogram = data->plot_type == GOOEY_PLOT_HISTOGRAM;
+
+    if (distribution->valid && distribution->data_generation == plot->data_generation)
+        return true;
+
+    distribution->valid = false;
+
+    GooeyPlotSummary summary;
+    if (!GooeyPlotStats_Summarize(data->x_data, data->data_count, &summary))
+        return false;
+
+    size_t count = plot->bin_count;
+    if (count == 0)
+        count = histogram ? GOOEY_PLOT_DEFAULT_HISTOGRAM_BINS : GOOEY_PLOT_DEFAULT_DENSITY_POINTS;
+    else if (!histogram && count < 2)
+        count = 2;
+
+    if (!distribution_reserve(distribution, count))
+    {
+        LOG_ERROR("Failed to allocate memory for plot distribution.");
+        return false;
+    }
+
+    float min = summary.min, max = summary.max;
+    if (histogram)
+    {
+        if (max <= min)
+            max = min + 1.0f;
+
+        size_t *bins = malloc(count * sizeof(size_t));
+        if (!bins || !GooeyPlotStats_Histogram(data->x_data, data->data_count, min, max, bins, count))
+        {
+            LOG_ERROR("Failed to compute histogram bins.");
+            free(bins);
+            return false;
+        }
+
+        distribution->bin_width = (max - min) / count;
+        for (size_t i = 0; i < count; ++i)
+            distribution->y[i] = (float)bins[i];
+        free(bins);
+    }
+    else
+    {
+        // Leave room for the tails of the outermost kernels.
+        float bandwidth = GooeyPlotStats_DefaultBandwidth(&summary);
+        min -= 3.0f * bandwidth;
+        max += 3.0f * bandwidth;
+
+        if (!GooeyPlotStats_Density(data->x_data, data->data_count, min, max, bandwidth, distribution->y, count))
+        {
+            LOG_ERROR("Failed to compute density estimate.");
+            return false;
+        }
+
+        distribution->bin_width = (max - min) / (count - 1);
+    }
+
+    float peak = 0.0f;
+    for (size_t i = 0; i < count; ++i)
+    {
+        distribution->x[i] = min + i * distribution->bin_width;
+        if (distribution->y[i] > peak)
+            peak = distribution->y[i];
+    }
+
+    data->min_x_value = min;
+    data->max_x_value = max;
+    data->min_y_value = 0.0f;
+    data->max_y_value = peak > 0.0f ? peak : 1.0f;
+
+    distribution->count = count;
+    distribution->data_generation = plot->data_generation;
+    distribution->valid = true;
+    return true;
+}
+
+/**
+ * @brief Rebuilds the candle pyramid from the plot's data if the data changed since.
+ */
+static bool candles_sync(GooeyPlot *plot)
+{
+    GooeyPlotCandles *candles = &plot->candles;
+    const GooeyPlotData *data = plot->data;
+
+    if (candles->built && candles->data_generation == plot->data_generation)
+        return true;
+
+    GooeyPlotPyramid_Clear(&candles->pyramid);
+    candles->built = false;
+    candles->view_valid = false;
+
+    if (data->x_data && data->y_data)
+    {
+        double times[256];
+        for (size_t i = 0; i < data->data_count; i += 256)
+        {
+            size_t count = data->data_count - i < 256 ? data->data_count - i : 256;
+            for (size_t j = 0; j < count; ++j)
+                times[j] = data->x_data[i + j];
+
+            if (!GooeyPlotPyramid_Append(&candles->pyramid, times, data->y_data + i, count))
+                return false;
+        }
+    }
+
+    candles->built = true;
+    candles->appended = false;
+    candles->data_generation = plot->data_generation;
+    return true;
+}
+
+static bool candles_reserve(GooeyPlotCandles *candles, size_t count)
+{
+    if (count <= candles->capacity)
+        return true;
+
+    float *xs = realloc(candles->xs, 4 * count * sizeof(float));
+    if (!xs)
+        return false;
+    candles->xs = xs;
+
+    float *ys = realloc(candles->ys, 4 * count * sizeof(float));
+    if (!ys)
+        return false;
+    candles->ys = ys;
+
+    candles->capacity = count;
+    return true;
+}
+
+/**
+ * @brief Value the data's x values are relative to: the view's start for candle plots, whose times need doubles.
+ */
+static double plot_x_origin(const GooeyPlot *plot)
+{
+    return plot_is_aggregated(plot->data) ? plot->candles.view_start : 0.0;
+}
+
+/**
+ * @brief Picks the candles in view from the coarsest pyramid level that still resolves the plot's width, and fits the axes to them.
+ *
+ * Nothing is computed while the ticks, the time range and the width stay the same.
+ *
+ * @return false if there is nothing to draw, the plot is skipped then.
+ */
+static bool prepare_candles(GooeyPlot *plot, const uint8_t MARGIN)
+{
+    GooeyPlotCandles *candles = &plot->candles;
+    GooeyPlotData *data = plot->data;
+
+    if (!candles_sync(plot))
+        return false;
+
+    const GooeyPlotPyramid *pyramid = &candles->pyramid;
+    if (pyramid->tick_count == 0)
+        return false;
+
+    double start = candles->range_fixed ? candles->range_start : pyramid->levels[0].candles[0].time;
+    double end = candles->range_fixed ? candles->range_end : pyramid->last_time;
+    if (end <= start)
+        end = start + 1.0;
+    int width = plot->core.width > 2 * MARGIN ? plot->core.width - 2 * MARGIN : 1;
+
+    if (candles->view_valid && candles->view_generation == plot->data_generation &&
+        candles->view_start == start && candles->view_end == end && candles->view_width == width)
+        return true;
+
+    candles->view_valid = false;
+
+    float pixels = data->plot_type == GOOEY_PLOT_TIME_SERIES ? TIME_SERIES_PIXELS : CANDLE_PIXELS;
+    size_t level = GooeyPlotPyramid_PickLevel((end - start) * pixels / width);
+    const GooeyPlotCandleLevel *candle_level = &pyramid->levels[level];
+    double bucket_width = GooeyPlotPyramid_BucketWidth(level);
+
+    size_t first = GooeyPlotPyramid_Find(pyramid, level, start);
+    size_t last = first;
+    while (last < candle_level->count && candle_level->candles[last].time <= end)
+        ++last;
+
+    if (!candles_reserve(candles, last - first))
+    {
+        LOG_ERROR("Failed to allocate memory for plot candles.");
+        return false;
+    }
+
+    float low = INFINITY, high = -INFINITY;
+    for (size_t i = first; i < last; ++i)
+    {
+        const GooeyPlotCandle *candle = &candle_level->candles[i];
+        float *xs = candles->xs + 4 * (i - first);
+        float *ys = candles->ys + 4 * (i - first);
+        bool rising = candle->close >= candle->open;
+
+        // Epoch times don't fit a float to the second, offsets within the view do.
+        xs[0] = xs[1] = xs[2] = xs[3] = (float)(candle->time + bucket_width / 2 - start);
+        // The order a time series line goes through the extremes, the likelier one for the bucket's direction.
+        ys[0] = candle->open;
+        ys[1] = rising ? candle->low : candle->high;
+        ys[2] = rising ? candle->high : candle->low;
+        ys[3] = candle->close;
+
+        if (candle->low < low)
+            low = candle->low;
+        if (candle->high > high)
+            high = candle->high;
+    }
+
+    if (last == first)
+    {
+        low = 0.0f;
+        high = 1.0f;
+    }
+    else if (high <= low)
+    {
+        high = low + 1.0f;
+    }
+
+    data->min_x_value = 0.0f;
+    data->max_x_value = (float)(end - start);
+    data->min_y_value = low;
+    data->max_y_value = high;
+
+    candles->candle_count = last - first;
+    candles->bucket_width = (float)bucket_width;
+    candles->view_generation = plot->data_generation;
+    candles->view_start = start;
+    candles->view_end = end;
+    candles->view_width = width;
+    candles->view_valid = true;
+    return true;
+}
+
 static void draw_plot_background(GooeyPlot *plot, GooeyWindow *win)
 {
     active_backend->FillRectangle(
@@ -138,154 +1023,527 @@ static void draw_axes(GooeyPlot *plot, GooeyWindow *win, const uint8_t MARGIN)
         active_theme->neutral,
         win->creation_id);
 
-    // Draw the Y axis
-    active_backend->DrawLine(
-        plot->core.x + MARGIN,
-        plot->core.y + plot->core.height - MARGIN,
-        plot->core.x + MARGIN,
-        plot->core.y + MARGIN,
-        active_theme->neutral,
-        win->creation_id);
-}
+    // Draw the Y axis
+    active_backend->DrawLine(
+        plot->core.x + MARGIN,
+        plot->core.y + plot->core.height - MARGIN,
+        plot->core.x + MARGIN,
+        plot->core.y + MARGIN,
+        active_theme->neutral,
+        win->creation_id);
+}
+
+static void draw_plot_title(GooeyPlot *plot, GooeyWindow *win, const uint8_t MARGIN)
+{
+    if (!plot->data->title)
+        return;
+
+    active_backend->DrawText(
+        plot->layout.title_x,
+        plot->core.y + MARGIN / 2,
+        plot->data->title,
+        active_theme->primary,
+        0.26f,
+        win->creation_id);
+}
+
+static bool layout_reserve_samples(GooeyPlotLayout *layout, size_t count)
+{
+    if (count <= layout->sample_capacity)
+        return true;
+
+    float *new_x = realloc(layout->sample_x, count * sizeof(float));
+    if (!new_x)
+        return false;
+    layout->sample_x = new_x;
+
+    float *new_y = realloc(layout->sample_y, count * sizeof(float));
+    if (!new_y)
+        return false;
+    layout->sample_y = new_y;
+
+    unsigned char *new_clip = realloc(layout->sample_clip, count);
+    if (!new_clip)
+        return false;
+    layout->sample_clip = new_clip;
+
+    unsigned char *new_colors = realloc(layout->sample_colors, count * 4);
+    if (!new_colors)
+        return false;
+    layout->sample_colors = new_colors;
+
+    layout->sample_capacity = count;
+    return true;
+}
+
+static bool layout_reserve_labels(char (**labels)[GOOEY_PLOT_TICK_LABEL_SIZE], unsigned int *capacity, unsigned int count)
+{
+    if (count <= *capacity)
+        return true;
+
+    char(*new_labels)[GOOEY_PLOT_TICK_LABEL_SIZE] = realloc(*labels, count * sizeof(**labels));
+    if (!new_labels)
+        return false;
+
+    *labels = new_labels;
+    *capacity = count;
+    return true;
+}
+
+static bool layout_is_current(const GooeyPlot *plot)
+{
+    const GooeyPlotLayout *layout = &plot->layout;
+    const GooeyPlotData *data = plot->data;
+
+    return layout->valid &&
+           layout->data_generation == plot->data_generation &&
+           layout->decimation == plot->decimation &&
+           layout->render_mode == plot->render_mode &&
+           layout->x == plot->core.x && layout->y == plot->core.y &&
+           layout->width == plot->core.width && layout->height == plot->core.height &&
+           layout->min_x == data->min_x_value && layout->max_x == data->max_x_value &&
+           layout->min_y == data->min_y_value && layout->max_y == data->max_y_value &&
+           layout->x_step == data->x_step && layout->y_step == data->y_step &&
+           layout->title == data->title &&
+           layout->x_origin == plot_x_origin(plot);
+}
+
+/**
+ * @brief Ticks of one axis: `count` values from `first`, `step` apart.
+ *
+ * Kept in doubles, an axis of epoch times needs more digits than a float has.
+ */
+typedef struct
+{
+    double first;
+    double step;
+    unsigned int count;
+    int decimals; /**< Decimals the labels need to tell the ticks apart */
+} AxisTicks;
+
+/**
+ * @brief Smallest step of the form 1, 2 or 5 times a power of ten that is at least `raw`.
+ */
+static double nice_step(double raw)
+{
+    double magnitude = pow(10.0, floor(log10(raw)));
+    double fraction = raw / magnitude;
+
+    if (fraction <= 1.0)
+        return magnitude;
+    if (fraction <= 2.0)
+        return 2.0 * magnitude;
+    if (fraction <= 5.0)
+        return 5.0 * magnitude;
+    return 10.0 * magnitude;
+}
+
+/**
+ * @brief Picks ticks at round values of [min, max], no closer than `min_spacing` pixels.
+ *
+ * @param preferred_step Step asked for by the data, used when its ticks fit, 0 for none.
+ */
+static void compute_axis_ticks(double min, double max, float pixels, float min_spacing, double preferred_step, AxisTicks *ticks)
+{
+    double range = max - min;
+    unsigned int max_intervals = pixels > 2 * min_spacing ? (unsigned int)(pixels / min_spacing) : 1;
+
+    double step = preferred_step;
+    if (!(step > 0.0) || range / step > max_intervals)
+        step = nice_step(range / max_intervals);
+
+    double first = ceil(min / step - 1e-4) * step;
+    double span = (max - first) / step + 1e-4;
+    unsigned int count = span >= 0.0 ? (unsigned int)span + 1 : 0;
+    if (count > max_intervals + 1)
+        count = max_intervals + 1;
+
+    int decimals = 0;
+    while (decimals < TICK_MAX_DECIMALS)
+    {
+        double scaled = step * pow(10.0, decimals);
+        if (fabs(scaled - round(scaled)) < 1e-3 * scaled)
+            break;
+        ++decimals;
+    }
+
+    *ticks = (AxisTicks){.first = first, .step = step, .count = count, .decimals = decimals};
+}
+
+static void format_tick_labels(char (*labels)[GOOEY_PLOT_TICK_LABEL_SIZE], const AxisTicks *ticks)
+{
+    for (unsigned int idx = 0; idx < ticks->count; ++idx)
+    {
+        double value = ticks->first + ticks->step * idx;
+        // Keeps a tick at zero from printing as -0.
+        if (fabs(value) < ticks->step * 1e-4)
+            value = 0.0;
+        snprintf(labels[idx], GOOEY_PLOT_TICK_LABEL_SIZE, "%.*f", ticks->decimals, value);
+    }
+}
+
+/**
+ * @brief Brings the plot's cached layout up to date: tick counts, tick labels and screen coordinates of the samples.
+ *
+ * @return false if the layout couldn't be computed, the plot is skipped then.
+ */
+static bool update_layout(GooeyPlot *plot, const uint8_t MARGIN)
+{
+    if (layout_is_current(plot))
+        return true;
+
+    GooeyPlotLayout *layout = &plot->layout;
+    const GooeyPlotData *data = plot->data;
+    layout->valid = false;
+
+    float min_x = data->min_x_value, max_x = data->max_x_value;
+    float min_y = data->min_y_value, max_y = data->max_y_value;
+    if (max_x <= min_x)
+        max_x = min_x + 1;
+    if (max_y <= min_y)
+        max_y = min_y + 1;
+
+    float plot_width = plot->core.width - 2 * MARGIN;
+    float plot_height = plot->core.height - 2 * MARGIN;
+
+    // Axes fitted to computed bins, candles or a moving view get steps that suit whatever they show.
+    bool fitted_x = plot_is_aggregated(data);
+    bool fitted_y = fitted_x || plot_is_distribution(data);
+    double x_origin = plot_x_origin(plot);
+    AxisTicks x_ticks, y_ticks;
+    compute_axis_ticks(x_origin + min_x, x_origin + max_x, plot_width, X_TICK_MIN_SPACING, fitted_x ? 0.0f : data->x_step, &x_ticks);
+    compute_axis_ticks(min_y, max_y, plot_height, Y_TICK_MIN_SPACING, fitted_y ? 0.0f : data->y_step, &y_ticks);
+
+    const float *sample_xs, *sample_ys;
+    size_t sample_count;
+    if (plot_uses_gpu(plot) || data->plot_type == GOOEY_PLOT_HEATMAP)
+    {
+        // The GPU maps the samples, only the axes are laid out here.
+        sample_xs = sample_ys = NULL;
+        sample_count = 0;
+    }
+    else if (plot_is_distribution(data))
+    {
+        sample_xs = plot->distribution.x;
+        sample_ys = plot->distribution.y;
+        sample_count = plot->distribution.count;
+    }
+    else if (plot_is_aggregated(data))
+    {
+        sample_xs = plot->candles.xs;
+        sample_ys = plot->candles.ys;
+        sample_count = 4 * plot->candles.candle_count;
+    }
+    else if (data->plot_type == GOOEY_PLOT_LINE)
+    {
+        prepare_line_samples(plot, plot->core.width > 2 * MARGIN ? plot->core.width - 2 * MARGIN : 0,
+                             &sample_xs, &sample_ys, &sample_count);
+    }
+    else
+    {
+        sample_xs = data->x_data;
+        sample_ys = data->y_data;
+        sample_count = data->data_count;
+    }
+
+    if (!layout_reserve_samples(layout, sample_count) ||
+        !layout_reserve_labels(&layout->x_labels, &layout->x_label_capacity, x_ticks.count) ||
+        !layout_reserve_labels(&layout->y_labels, &layout->y_label_capacity, y_ticks.count))
+    {
+        LOG_ERROR("Failed to allocate memory for plot coordinates.");
+        return false;
+    }
+
+    float x_scale = plot_width / (max_x - min_x);
+    float y_scale = plot_height / (max_y - min_y);
+    float left = plot->core.x + MARGIN;
+    float bottom = plot->core.y + plot->core.height - MARGIN;
 
-static void draw_plot_title(GooeyPlot *plot, GooeyWindow *win, const uint8_t MARGIN)
-{
-    active_backend->DrawText(
-        plot->core.x + ((plot->core.width / 2) - (active_backend->GetTextWidth(plot->data->title, strlen(plot->data->title)) / 2)),
-        plot->core.y + MARGIN / 2,
-        plot->data->title,
-        active_theme->primary,
-        0.26f,
-        win->creation_id);
+    layout->x_tick_count = x_ticks.count;
+    layout->y_tick_count = y_ticks.count;
+    layout->x_tick_start = left + (float)(x_ticks.first - x_origin - min_x) * x_scale;
+    layout->y_tick_start = bottom - (float)(y_ticks.first - min_y) * y_scale;
+    layout->x_tick_spacing = (float)x_ticks.step * x_scale;
+    layout->y_tick_spacing = (float)-y_ticks.step * y_scale;
+    format_tick_labels(layout->x_labels, &x_ticks);
+    format_tick_labels(layout->y_labels, &y_ticks);
+
+    if (data->title)
+        layout->title_x = plot->core.x + plot->core.width / 2 - active_backend->GetTextWidth(data->title, strlen(data->title)) / 2;
+
+    GooeyPlotTransform transform = {
+        .scale_x = x_scale,
+        .offset_x = left - min_x * x_scale,
+        .scale_y = -y_scale,
+        .offset_y = bottom + min_y * y_scale,
+        .clip_left = left,
+        .clip_right = plot->core.x + plot->core.width - MARGIN,
+        .clip_top = plot->core.y + MARGIN,
+        .clip_bottom = bottom,
+    };
+    GooeyPlotKernels_Transform(&transform, sample_xs, sample_ys, sample_count,
+                               layout->sample_x, layout->sample_y, layout->sample_clip);
+    layout->sample_count = sample_count;
+    layout->transform = transform;
+
+    if (plot_has_marker_data(plot) && data->color_data && sample_xs == data->x_data)
+    {
+        for (size_t i = 0; i < sample_count; ++i)
+        {
+            layout->sample_colors[i * 4] = (data->color_data[i] >> 16) & 0xFF;
+            layout->sample_colors[i * 4 + 1] = (data->color_data[i] >> 8) & 0xFF;
+            layout->sample_colors[i * 4 + 2] = data->color_data[i] & 0xFF;
+            layout->sample_colors[i * 4 + 3] = 0xFF;
+        }
+    }
+
+    layout->data_generation = plot->data_generation;
+    layout->decimation = plot->decimation;
+    layout->render_mode = plot->render_mode;
+    layout->x = plot->core.x;
+    layout->y = plot->core.y;
+    layout->width = plot->core.width;
+    layout->height = plot->core.height;
+    layout->min_x = data->min_x_value;
+    layout->max_x = data->max_x_value;
+    layout->min_y = data->min_y_value;
+    layout->max_y = data->max_y_value;
+    layout->x_step = data->x_step;
+    layout->y_step = data->y_step;
+    layout->title = data->title;
+    layout->x_origin = x_origin;
+    layout->valid = true;
+    return true;
 }
 
-static void draw_x_axis_ticks(GooeyPlot *plot, GooeyWindow *win, const uint8_t MARGIN, const uint8_t VALUE_TICK_OFFSET, float min_x_value, float x_value_spacing, uint32_t x_tick_count, float *plot_x_grid_coords)
+static void draw_x_axis_ticks(GooeyPlot *plot, GooeyWindow *win, const uint8_t MARGIN, const uint8_t VALUE_TICK_OFFSET)
 {
-    float x_default_value = min_x_value;
-    for (size_t idx = 0; idx < x_tick_count; ++idx)
+    const GooeyPlotLayout *layout = &plot->layout;
+    const float axis_x = plot->core.x + MARGIN;
+    for (size_t idx = 0; idx < layout->x_tick_count; ++idx)
     {
-        if (idx != 0)
+        float tick_x = layout->x_tick_start + layout->x_tick_spacing * idx;
+        // The Y axis already marks a tick at the origin.
+        if (tick_x > axis_x + 0.5f)
         {
             active_backend->DrawLine(
-                plot->core.x + MARGIN + x_value_spacing * idx,
+                tick_x,
                 plot->core.y + plot->core.height - MARGIN + VALUE_TICK_OFFSET,
-                plot->core.x + MARGIN + x_value_spacing * idx,
+                tick_x,
                 plot->core.y + plot->core.height - MARGIN - VALUE_TICK_OFFSET,
                 active_theme->primary,
                 win->creation_id);
-
-            plot_x_grid_coords[idx - 1] = plot->core.x + MARGIN + x_value_spacing * idx;
         }
 
-        char x_value_str[64];
-        snprintf(x_value_str, sizeof(x_value_str), "%.2f", x_default_value);
         active_backend->DrawText(
-            plot->core.x + MARGIN + x_value_spacing * idx,
+            tick_x,
             plot->core.y + plot->core.height - MARGIN + VALUE_TICK_OFFSET + 15,
-            x_value_str,
+            layout->x_labels[idx],
             active_theme->neutral,
             0.26f,
             win->creation_id);
-
-        x_default_value += plot->data->x_step;
     }
 }
 
-static void draw_y_axis_ticks(GooeyPlot *plot, GooeyWindow *win, const uint8_t MARGIN, const uint8_t VALUE_TICK_OFFSET, float min_y_value, float y_value_spacing, uint32_t y_tick_count, float *plot_y_grid_coords)
+static void draw_y_axis_ticks(GooeyPlot *plot, GooeyWindow *win, const uint8_t MARGIN, const uint8_t VALUE_TICK_OFFSET)
 {
-    float y_default_value = min_y_value;
-    for (size_t idx = 0; idx < y_tick_count; ++idx)
+    const GooeyPlotLayout *layout = &plot->layout;
+    const float axis_y = plot->core.y + plot->core.height - MARGIN;
+    for (size_t idx = 0; idx < layout->y_tick_count; ++idx)
     {
-        if (idx != 0)
+        float tick_y = layout->y_tick_start + layout->y_tick_spacing * idx;
+        if (tick_y < axis_y - 0.5f)
         {
             active_backend->DrawLine(
                 plot->core.x + MARGIN - VALUE_TICK_OFFSET,
-                plot->core.y + plot->core.height - MARGIN - y_value_spacing * idx,
+                tick_y,
                 plot->core.x + MARGIN + VALUE_TICK_OFFSET,
-                plot->core.y + plot->core.height - MARGIN - y_value_spacing * idx,
+                tick_y,
                 active_theme->primary,
                 win->creation_id);
-
-            plot_y_grid_coords[idx - 1] = plot->core.y + plot->core.height - MARGIN - y_value_spacing * idx;
         }
 
-        char y_value_str[64];
-        snprintf(y_value_str, sizeof(y_value_str), "%.2f", y_default_value);
         active_backend->DrawText(
             plot->core.x,
-            plot->core.y + plot->core.height - MARGIN - y_value_spacing * idx,
-            y_value_str,
+            tick_y,
+            layout->y_labels[idx],
             active_theme->neutral,
             0.26f,
             win->creation_id);
-
-        y_default_value += plot->data->y_step;
     }
 }
 
-static void draw_grid_lines(GooeyPlot *plot, GooeyWindow *win, uint32_t x_tick_count, uint32_t y_tick_count, float *plot_x_grid_coords, float *plot_y_grid_coords, const uint8_t MARGIN)
+static void draw_grid_lines(GooeyPlot *plot, GooeyWindow *win, const uint8_t MARGIN)
 {
-    for (size_t i = 0; i < x_tick_count - 1; ++i)
+    const GooeyPlotLayout *layout = &plot->layout;
+    const float axis_x = plot->core.x + MARGIN;
+    const float axis_y = plot->core.y + plot->core.height - MARGIN;
+
+    for (size_t idx = 0; idx < layout->x_tick_count; ++idx)
     {
+        float grid_x = layout->x_tick_start + layout->x_tick_spacing * idx;
+        if (grid_x <= axis_x + 0.5f)
+            continue;
+
         active_backend->DrawLine(
-            plot_x_grid_coords[i],
+            grid_x,
             plot->core.y + plot->core.height - MARGIN,
-            plot_x_grid_coords[i],
+            grid_x,
             plot->core.y + MARGIN,
             active_theme->base,
             win->creation_id);
     }
 
-    for (size_t i = 0; i < y_tick_count - 1; ++i)
+    for (size_t idx = 0; idx < layout->y_tick_count; ++idx)
     {
+        float grid_y = layout->y_tick_start + layout->y_tick_spacing * idx;
+        if (grid_y >= axis_y - 0.5f)
+            continue;
+
         active_backend->DrawLine(
             plot->core.x + MARGIN,
-            plot_y_grid_coords[i],
+            grid_y,
             plot->core.x + plot->core.width - MARGIN,
-            plot_y_grid_coords[i],
+            grid_y,
             active_theme->base,
             win->creation_id);
     }
 }
 
-static void draw_data_points(GooeyPlot *plot, GooeyWindow *win, float min_x_value, float min_y_value, uint32_t x_tick_count, uint32_t y_tick_count, float *plot_x_coords, float *plot_y_coords, const uint8_t MARGIN)
+static void draw_data_points(GooeyPlot *plot, GooeyWindow *win, const uint8_t MARGIN)
 {
-    for (size_t j = 0; j < plot->data->data_count; ++j)
-    {
-        float x_axis_length = ((x_tick_count - 1) * plot->data->x_step);
-        float y_axis_length = ((y_tick_count - 1) * plot->data->y_step);
+    const float *plot_x_coords = plot->layout.sample_x;
+    const float *plot_y_coords = plot->layout.sample_y;
+    const unsigned char *clip = plot->layout.sample_clip;
+    size_t count = plot->layout.sample_count;
 
-        float normalized_x = (float)(plot->data->x_data[j] - min_x_value) / x_axis_length;
-        float normalized_y = (float)(plot->data->y_data[j] - min_y_value) / y_axis_length;
+    if (plot_uses_gpu(plot))
+    {
+        const GooeyPlotStream *stream = &plot->stream;
+        size_t first = stream->total > stream->capacity ? (stream->total - stream->capacity) % stream->capacity : 0;
+        float point_size = plot->data->plot_type == GOOEY_PLOT_SCATTER ? SCATTER_MARKER_SIZE : 0.0f;
 
-        plot_x_coords[j] = plot->core.x + MARGIN + normalized_x * (plot->core.width - 2 * MARGIN);
-        plot_y_coords[j] = plot->core.y + plot->core.height - MARGIN - normalized_y * (plot->core.height - 2 * MARGIN);
+        active_backend->DrawSeries(plot->gpu.series, first, plot->data->data_count, &plot->layout.transform,
+                                   point_size, active_theme->primary, win->creation_id);
+        return;
     }
 
     switch (plot->data->plot_type)
     {
+    case GOOEY_PLOT_HEATMAP:
+    {
+        const GooeyPlotTransform *transform = &plot->layout.transform;
+        const GooeyPlotData *data = plot->data;
+        float left = data->min_x_value * transform->scale_x + transform->offset_x;
+        float right = data->max_x_value * transform->scale_x + transform->offset_x;
+        float top = data->max_y_value * transform->scale_y + transform->offset_y;
+        float bottom = data->min_y_value * transform->scale_y + transform->offset_y;
+
+        active_backend->DrawHeatmap(plot->heatmap.texture, left, top, right - left, bottom - top, plot->heatmap.head,
+                                    plot->heatmap.min_value, plot->heatmap.max_value, win->creation_id);
+        break;
+    }
+
     case GOOEY_PLOT_LINE:
     {
-        for (size_t j = 0; j < plot->data->data_count - 1; ++j)
+        // Draw each run of consecutive segments that may show as one polyline. A segment
+        // whose ends lie beyond the same edge of the plot area can't show and ends the run.
+        size_t run_start = 0;
+        for (size_t j = 0; j + 1 < count; ++j)
         {
-            active_backend->DrawLine(
-                plot_x_coords[j],
-                plot_y_coords[j],
-                plot_x_coords[j + 1],
-                plot_y_coords[j + 1],
-                active_theme->primary,
-                win->creation_id);
+            if (!(clip[j] & clip[j + 1]))
+                continue;
+
+            active_backend->DrawPolyline(plot_x_coords + run_start, plot_y_coords + run_start, j + 1 - run_start,
+                                         active_theme->primary, 1.0f, win->creation_id);
+            run_start = j + 1;
+        }
+
+        active_backend->DrawPolyline(plot_x_coords + run_start, plot_y_coords + run_start, count - run_start,
+                                     active_theme->primary, 1.0f, win->creation_id);
+        break;
+    }
+
+    case GOOEY_PLOT_HISTOGRAM:
+    {
+        float bar_width = fmaxf(plot->distribution.bin_width * plot->layout.transform.scale_x, 1.0f);
+        float baseline = plot->core.y + plot->core.height - MARGIN;
+
+        // Leave a pixel between bars wide enough to spare it.
+        if (bar_width > 2.0f)
+            bar_width -= 1.0f;
+
+        for (size_t j = 0; j < count; ++j)
+        {
+            if (plot_y_coords[j] >= baseline)
+                continue;
+
+            active_backend->FillRectangle(plot_x_coords[j], plot_y_coords[j], bar_width, baseline - plot_y_coords[j],
+                                          active_theme->primary, win->creation_id);
+        }
+        break;
+    }
+
+    case GOOEY_PLOT_DENSITY:
+    case GOOEY_PLOT_TIME_SERIES:
+        active_backend->DrawPolyline(plot_x_coords, plot_y_coords, count, active_theme->primary, 1.0f, win->creation_id);
+        break;
+
+    case GOOEY_PLOT_CANDLESTICK:
+    case GOOEY_PLOT_OHLC:
+    {
+        bool candlestick = plot->data->plot_type == GOOEY_PLOT_CANDLESTICK;
+        float body_width = fmaxf(plot->candles.bucket_width * plot->layout.transform.scale_x * CANDLE_BODY_RATIO, 1.0f);
+
+        // Each candle is four points: open, low and high in either order, then close.
+        for (size_t j = 0; j + 3 < count; j += 4)
+        {
+            float x = plot_x_coords[j];
+            float open = plot_y_coords[j];
+            float close = plot_y_coords[j + 3];
+            float top = fminf(plot_y_coords[j + 1], plot_y_coords[j + 2]);
+            float bottom = fmaxf(plot_y_coords[j + 1], plot_y_coords[j + 2]);
+            // Screen y grows downwards, a close above the open is a rise.
+            unsigned long color = close <= open ? active_theme->success : active_theme->danger;
+
+            active_backend->DrawLine(x, top, x, bottom, color, win->creation_id);
+
+            if (candlestick)
+            {
+                float body_top = fminf(open, close);
+                active_backend->FillRectangle(x - body_width / 2, body_top, body_width, fmaxf(fabsf(close - open), 1.0f),
+                                              color, win->creation_id);
+            }
+            else
+            {
+                active_backend->DrawLine(x - body_width / 2, open, x, open, color, win->creation_id);
+                active_backend->DrawLine(x, close, x + body_width / 2, close, color, win->creation_id);
+            }
         }
         break;
     }
 
+    case GOOEY_PLOT_SCATTER:
+    case GOOEY_PLOT_BUBBLE:
+    {
+        const GooeyPlotData *data = plot->data;
+        bool has_marker_data = plot_has_marker_data(plot);
+        float size = data->plot_type == GOOEY_PLOT_BUBBLE ? BUBBLE_MARKER_SIZE : SCATTER_MARKER_SIZE;
+
+        active_backend->DrawMarkers(plot_x_coords, plot_y_coords, count,
+                                    has_marker_data ? data->size_data : NULL,
+                                    has_marker_data && data->color_data ? plot->layout.sample_colors : NULL,
+                                    size, active_theme->primary, win->creation_id);
+        break;
+    }
+
     case GOOEY_PLOT_BAR:
 
     {
         const uint8_t bar_width = 30;
 
         // todo: fix the first value on the bar plot.
-        for (size_t j = 0; j < plot->data->data_count; ++j)
+        for (size_t j = 0; j < count; ++j)
         {
             float bar_x = plot_x_coords[j] - ((float)bar_width / 2);
             float bar_height = (plot->core.y + plot->core.height - MARGIN) - plot_y_coords[j];
@@ -320,6 +1578,7 @@ GooeyPlot *GooeyPlot_Add(GooeyWindow *win, GOOEY_PLOT_TYPE plot_type, GooeyPlotD
 
     GooeyPlot *plot = &win->plots[win->plot_count++];
     *plot = (GooeyPlot){0};
+    pthread_mutex_init(&plot->inbox.lock, NULL);
 
     plot->core.x = x;
     plot->core.y = y;
@@ -328,12 +1587,20 @@ GooeyPlot *GooeyPlot_Add(GooeyWindow *win, GOOEY_PLOT_TYPE plot_type, GooeyPlotD
     plot->core.type = WIDGET_PLOT;
     plot->data = data;
     plot->data->plot_type = plot_type;
+    plot->decimation = GOOEY_PLOT_DECIMATION_M4;
+    plot->data_generation = 1;
     if (plot->data)
     {
         calculate_min_max_values(plot->data);
-        add_placeholder_point(plot->data);
-        sort_data(plot->data);
+
+        // Histograms and densities keep their raw samples as given, ticks only need to be in time order.
+        // Markers would show the placeholder as a point of its own.
+        if (!plot_is_distribution(plot->data) && !plot_is_aggregated(plot->data) && !plot_draws_markers(plot->data))
+            add_placeholder_point(plot);
+        if (!plot_is_distribution(plot->data))
+            sort_data(plot->data);
     }
+    GooeyWindow_RegisterWidget(win, (GooeyWidget *)&plot->core);
 
 
     return plot;
@@ -352,58 +1619,84 @@ void GooeyPlot_Draw(GooeyWindow *win)
     for (size_t i = 0; i < win->plot_count; ++i)
     {
         GooeyPlot *plot = &win->plots[i];
-        if (!plot->data || !plot->data->x_data || !plot->data->y_data)
+        if (!plot->data)
+            continue;
+
+        if (!plot_has_data(plot))
         {
             continue;
         }
 
+        if (!GooeyWindow_IsDamaged(win, &plot->core))
+            continue;
 
-        float x_range = plot->data->max_x_value - plot->data->min_x_value;
-        float y_range = plot->data->max_y_value - plot->data->min_y_value;
-        if (x_range == 0)
-            x_range = 1;
-        if (y_range == 0)
-            y_range = 1;
+        if (plot->data->plot_type == GOOEY_PLOT_HEATMAP && !heatmap_sync(plot, win))
+        {
+            LOG_ERROR("Couldn't upload heatmap to the GPU.");
+            continue;
+        }
 
-        uint32_t x_tick_count = (uint32_t)(ceilf(x_range / plot->data->x_step)) + 1;
-        uint32_t y_tick_count = (uint32_t)(ceilf(y_range / plot->data->y_step)) + 1;
-        LOG_INFO("%u",  x_tick_count);
+        if (plot_is_distribution(plot->data) && !prepare_distribution(plot))
+            continue;
 
-        float *plot_x_coords = malloc(plot->data->data_count * sizeof(float));
-        float *plot_y_coords = malloc(plot->data->data_count * sizeof(float));
-        float *plot_x_grid_coords = malloc((x_tick_count - 1) * sizeof(float));
-        float *plot_y_grid_coords = malloc((y_tick_count - 1) * sizeof(float));
+        if (plot_is_aggregated(plot->data) && !prepare_candles(plot, MARGIN))
+            continue;
 
-        if (!plot_x_coords || !plot_y_coords || !plot_x_grid_coords || !plot_y_grid_coords)
+        if (plot_uses_gpu(plot) && !gpu_series_sync(plot, win))
         {
-            LOG_ERROR("Failed to allocate memory for plot coordinates.");
-            free(plot_x_coords);
-            free(plot_y_coords);
-            free(plot_x_grid_coords);
-            free(plot_y_grid_coords);
-            continue;
+            LOG_ERROR("Couldn't upload plot samples to the GPU, drawing them on the CPU.");
+            gpu_series_release(plot);
+            plot->render_mode = GOOEY_PLOT_RENDER_CPU;
         }
 
+        if (!update_layout(plot, MARGIN))
+            continue;
+
         draw_plot_background(plot, win);
         draw_axes(plot, win, MARGIN);
         draw_plot_title(plot, win, MARGIN);
-
-        float x_value_spacing = (plot->core.width - 2 * MARGIN) / (x_tick_count - 1);
-        draw_x_axis_ticks(plot, win, MARGIN, VALUE_TICK_OFFSET, plot->data->min_x_value, x_value_spacing, x_tick_count, plot_x_grid_coords);
-
-        float y_value_spacing = (plot->core.height - 2 * MARGIN) / (y_tick_count - 1);
-        draw_y_axis_ticks(plot, win, MARGIN, VALUE_TICK_OFFSET, plot->data->min_y_value, y_value_spacing, y_tick_count, plot_y_grid_coords);
-
-        draw_grid_lines(plot, win, x_tick_count, y_tick_count, plot_x_grid_coords, plot_y_grid_coords, MARGIN);
-        draw_data_points(plot, win, plot->data->min_x_value, plot->data->min_y_value, x_tick_count, y_tick_count, plot_x_coords, plot_y_coords, MARGIN);
-
-        free(plot_x_coords);
-        free(plot_y_coords);
-        free(plot_x_grid_coords);
-        free(plot_y_grid_coords);
+        draw_x_axis_ticks(plot, win, MARGIN, VALUE_TICK_OFFSET);
+        draw_y_axis_ticks(plot, win, MARGIN, VALUE_TICK_OFFSET);
+        draw_grid_lines(plot, win, MARGIN);
+        draw_data_points(plot, win, MARGIN);
     }
 }
 
+void GooeyPlot_Release(GooeyPlot *plot)
+{
+    free(plot->decimated_x);
+    free(plot->decimated_y);
+    free(plot->owned_x);
+    free(plot->owned_y);
+    plot->decimated_x = plot->decimated_y = NULL;
+    plot->owned_x = plot->owned_y = NULL;
+    stream_free(&plot->stream);
+    free(plot->distribution.x);
+    free(plot->distribution.y);
+    plot->distribution = (GooeyPlotDistribution){0};
+    GooeyPlotPyramid_Free(&plot->candles.pyramid);
+    free(plot->candles.xs);
+    free(plot->candles.ys);
+    plot->candles = (GooeyPlotCandles){0};
+    free(plot->layout.sample_x);
+    free(plot->layout.sample_y);
+    free(plot->layout.sample_clip);
+    free(plot->layout.sample_colors);
+    free(plot->layout.x_labels);
+    free(plot->layout.y_labels);
+    plot->layout = (GooeyPlotLayout){0};
+    gpu_series_release(plot);
+    free(plot->heatmap.values);
+    free(plot->heatmap.dirty_rows);
+    if (plot->heatmap.allocated && active_backend->DestroyHeatmap)
+        active_backend->DestroyHeatmap(plot->heatmap.texture);
+    plot->heatmap = (GooeyPlotHeatmap){0};
+    free(plot->inbox.x);
+    free(plot->inbox.y);
+    pthread_mutex_destroy(&plot->inbox.lock);
+    plot->inbox = (GooeyPlotInbox){0};
+}
+
 void GooeyPlot_Update(GooeyPlot *plot, GooeyPlotData *new_data)
 {
     if (!plot || !new_data)
@@ -412,6 +1705,388 @@ void GooeyPlot_Update(GooeyPlot *plot, GooeyPlotData *new_data)
         return;
     }
 
+    if (plot->stream.capacity)
+    {
+        // Streamed samples are kept in order as they come in.
+        if (new_data == plot->data)
+        {
+            plot->data_generation++;
+            GooeyWidget_MarkDirty(&plot->core);
+            return;
+        }
+
+        // The plot no longer shows the streamed samples.
+        stream_free(&plot->stream);
+    }
+
+    if (new_data == plot->data && plot_is_aggregated(new_data) && plot->candles.appended)
+    {
+        // Appended ticks only live in the pyramid, rebuilding it from the data would drop them.
+        plot->data_generation++;
+        plot->candles.data_generation = plot->data_generation;
+        GooeyWidget_MarkDirty(&plot->core);
+        return;
+    }
+
     plot->data = new_data;
-    sort_data(new_data);
-}
\ No newline at end of file
+    plot->data_generation++;
+    GooeyWidget_MarkDirty(&plot->core);
+    if (!plot_is_distribution(new_data))
+        sort_data(new_data);
+}
+
+void GooeyPlot_SetDecimation(GooeyPlot *plot, GOOEY_PLOT_DECIMATION mode)
+{
+    if (!plot)
+    {
+        LOG_ERROR("Invalid plot provided.");
+        return;
+    }
+
+    plot->decimation = mode;
+    GooeyWidget_MarkDirty(&plot->core);
+}
+
+bool GooeyPlot_SetRenderMode(GooeyPlot *plot, GOOEY_PLOT_RENDER mode)
+{
+    if (!plot)
+    {
+        LOG_ERROR("Invalid plot provided.");
+        return false;
+    }
+
+    if (mode == GOOEY_PLOT_RENDER_GPU && (!active_backend->CreateSeries || !active_backend->UploadSeries || !active_backend->DrawSeries))
+    {
+        LOG_ERROR("The active backend can't keep plot samples on the GPU.");
+        return false;
+    }
+
+    if (mode == GOOEY_PLOT_RENDER_CPU)
+        gpu_series_release(plot);
+
+    plot->render_mode = mode;
+    GooeyWidget_MarkDirty(&plot->core);
+    return true;
+}
+
+bool GooeyPlot_SetHeatmap(GooeyPlot *plot, const float *values, size_t columns, size_t rows)
+{
+    if (!plot_is_heatmap(plot))
+        return false;
+
+    if (!values || columns == 0 || rows == 0)
+    {
+        LOG_ERROR("Invalid heatmap values provided.");
+        return false;
+    }
+
+    if (!heatmap_supported())
+    {
+        LOG_ERROR("The active backend can't draw heatmaps.");
+        return false;
+    }
+
+    GooeyPlotHeatmap *heatmap = &plot->heatmap;
+    if (heatmap->columns != columns || heatmap->rows != rows)
+    {
+        float *new_values = malloc(columns * rows * sizeof(float));
+        unsigned char *new_dirty_rows = malloc(rows);
+        if (!new_values || !new_dirty_rows)
+        {
+            LOG_ERROR("Failed to allocate memory for heatmap.");
+            free(new_values);
+            free(new_dirty_rows);
+            return false;
+        }
+
+        free(heatmap->values);
+        free(heatmap->dirty_rows);
+        heatmap->values = new_values;
+        heatmap->dirty_rows = new_dirty_rows;
+        heatmap->columns = columns;
+        heatmap->rows = rows;
+    }
+
+    if (heatmap->colormap_count == 0)
+        GooeyPlot_SetHeatmapColormap(plot, default_heatmap_colormap, sizeof(default_heatmap_colormap) / sizeof(default_heatmap_colormap[0]));
+
+    heatmap->head = 0;
+    heatmap_write_rows(plot, 0, values, rows);
+
+    heatmap->min_value = FLT_MAX;
+    heatmap->max_value = -FLT_MAX;
+    for (size_t i = 0; i < columns * rows; ++i)
+    {
+        if (values[i] < heatmap->min_value)
+            heatmap->min_value = values[i];
+        if (values[i] > heatmap->max_value)
+            heatmap->max_value = values[i];
+    }
+
+    // The axes count columns and rows, row 0 at the bottom.
+    GooeyPlotData *data = plot->data;
+    data->min_x_value = 0;
+    data->max_x_value = columns;
+    data->min_y_value = 0;
+    data->max_y_value = rows;
+
+    plot->data_generation++;
+    return true;
+}
+
+bool GooeyPlot_SetHeatmapRows(GooeyPlot *plot, size_t first_row, const float *values, size_t row_count)
+{
+    if (!plot_is_heatmap(plot))
+        return false;
+
+    if (!values || !plot->heatmap.values || first_row + row_count > plot->heatmap.rows)
+    {
+        LOG_ERROR("Invalid heatmap rows provided.");
+        return false;
+    }
+
+    heatmap_write_rows(plot, first_row, values, row_count);
+    return true;
+}
+
+bool GooeyPlot_PushHeatmapRow(GooeyPlot *plot, const float *row)
+{
+    if (!plot_is_heatmap(plot))
+        return false;
+
+    GooeyPlotHeatmap *heatmap = &plot->heatmap;
+    if (!row || !heatmap->values)
+    {
+        LOG_ERROR("Invalid heatmap row provided.");
+        return false;
+    }
+
+    // The oldest row is overwritten and becomes the top one.
+    heatmap_write_rows(plot, 0, row, 1);
+    heatmap->head = (heatmap->head + 1) % heatmap->rows;
+    return true;
+}
+
+void GooeyPlot_SetHeatmapRange(GooeyPlot *plot, float min_value, float max_value)
+{
+    if (!plot_is_heatmap(plot))
+        return;
+
+    plot->heatmap.min_value = min_value;
+    plot->heatmap.max_value = max_value;
+    GooeyWidget_MarkDirty(&plot->core);
+}
+
+bool GooeyPlot_SetHeatmapColormap(GooeyPlot *plot, const unsigned long *colors, size_t count)
+{
+    if (!plot_is_heatmap(plot))
+        return false;
+
+    if (!colors || count < 2 || count > GOOEY_PLOT_COLORMAP_MAX)
+    {
+        LOG_ERROR("A heatmap colormap needs between 2 and %d colors.", GOOEY_PLOT_COLORMAP_MAX);
+        return false;
+    }
+
+    memcpy(plot->heatmap.colormap, colors, count * sizeof(unsigned long));
+    plot->heatmap.colormap_count = count;
+    plot->heatmap.colormap_dirty = true;
+    GooeyWidget_MarkDirty(&plot->core);
+    return true;
+}
+
+void GooeyPlot_SetBinCount(GooeyPlot *plot, size_t bin_count)
+{
+    if (!plot)
+    {
+        LOG_ERROR("Invalid plot provided.");
+        return;
+    }
+
+    // The bins are computed data, the distribution and the layout both follow the generation.
+    plot->bin_count = bin_count;
+    plot->data_generation++;
+    GooeyWidget_MarkDirty(&plot->core);
+}
+
+void GooeyPlot_SetTimeRange(GooeyPlot *plot, double start, double end)
+{
+    if (!plot)
+    {
+        LOG_ERROR("Invalid plot provided.");
+        return;
+    }
+
+    plot->candles.range_fixed = start < end;
+    plot->candles.range_start = start;
+    plot->candles.range_end = end;
+    GooeyWidget_MarkDirty(&plot->core);
+}
+
+bool GooeyPlot_SetStreamWindow(GooeyPlot *plot, size_t window_size)
+{
+    if (!plot || !plot->data || window_size == 0)
+    {
+        LOG_ERROR("Invalid plot or stream window size provided.");
+        return false;
+    }
+
+    return stream_init(plot, window_size);
+}
+
+bool GooeyPlot_Append(GooeyPlot *plot, float x, float y)
+{
+    return GooeyPlot_AppendBatch(plot, &x, &y, 1);
+}
+
+bool GooeyPlot_AppendBatch(GooeyPlot *plot, const float *x, const float *y, size_t count)
+{
+    if (!plot || !plot->data || !x || !y)
+    {
+        LOG_ERROR("Invalid plot or samples provided.");
+        return false;
+    }
+
+    if (count == 0)
+        return true;
+
+    if (plot_is_aggregated(plot->data))
+    {
+        double *times = malloc(count * sizeof(double));
+        if (!times)
+        {
+            LOG_ERROR("Failed to allocate memory for plot ticks.");
+            return false;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+            times[i] = x[i];
+
+        bool appended = GooeyPlot_AppendTicks(plot, times, y, count);
+        free(times);
+        return appended;
+    }
+
+    GooeyPlotStream *stream = &plot->stream;
+    if (stream->capacity == 0 && !stream_init(plot, GOOEY_PLOT_DEFAULT_STREAM_WINDOW))
+        return false;
+
+    float previous_x = stream->total ? stream->x[(stream->total - 1) % stream->capacity] : -INFINITY;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (x[i] < previous_x)
+        {
+            LOG_ERROR("Plot samples must be appended in non-decreasing x order.");
+            return false;
+        }
+        previous_x = x[i];
+    }
+
+    for (size_t i = 0; i < count; ++i)
+        stream_push(stream, x[i], y[i]);
+
+    stream_sync_data(plot);
+    return true;
+}
+
+bool GooeyPlot_Post(GooeyPlot *plot, const float *x, const float *y, size_t count)
+{
+    if (!plot || !x || !y)
+    {
+        LOG_ERROR("Invalid plot or samples provided.");
+        return false;
+    }
+
+    GooeyPlotInbox *inbox = &plot->inbox;
+    bool posted = true;
+    pthread_mutex_lock(&inbox->lock);
+
+    if (inbox->count + count > inbox->capacity)
+    {
+        size_t capacity = inbox->capacity ? inbox->capacity : 64;
+        while (capacity < inbox->count + count)
+            capacity *= 2;
+
+        float *new_x = realloc(inbox->x, capacity * sizeof(float));
+        if (new_x)
+            inbox->x = new_x;
+        float *new_y = realloc(inbox->y, capacity * sizeof(float));
+        if (new_y)
+            inbox->y = new_y;
+
+        if (new_x && new_y)
+        {
+            inbox->capacity = capacity;
+        }
+        else
+        {
+            LOG_ERROR("Failed to allocate memory for posted plot samples.");
+            posted = false;
+        }
+    }
+
+    if (posted)
+    {
+        memcpy(inbox->x + inbox->count, x, count * sizeof(float));
+        memcpy(inbox->y + inbox->count, y, count * sizeof(float));
+        inbox->count += count;
+    }
+
+    pthread_mutex_unlock(&inbox->lock);
+    return posted;
+}
+
+void GooeyPlot_DrainPosted(GooeyWindow *win)
+{
+    if (!win)
+        return;
+
+    for (size_t i = 0; i < win->plot_count; ++i)
+    {
+        GooeyPlot *plot = &win->plots[i];
+        GooeyPlotInbox *inbox = &plot->inbox;
+
+        pthread_mutex_lock(&inbox->lock);
+        if (inbox->count && plot->data)
+            GooeyPlot_AppendBatch(plot, inbox->x, inbox->y, inbox->count);
+        inbox->count = 0;
+        pthread_mutex_unlock(&inbox->lock);
+    }
+}
+
+bool GooeyPlot_AppendTicks(GooeyPlot *plot, const double *times, const float *prices, size_t count)
+{
+    if (!plot || !plot->data || !plot_is_aggregated(plot->data) || !times || !prices)
+    {
+        LOG_ERROR("Invalid candle plot or ticks provided.");
+        return false;
+    }
+
+    if (count == 0)
+        return true;
+
+    // Ticks go straight into the candle pyramid, which keeps all of them aggregated rather than a window.
+    GooeyPlotCandles *candles = &plot->candles;
+    if (!candles_sync(plot))
+        return false;
+
+    double previous_time = candles->pyramid.tick_count ? candles->pyramid.last_time : -INFINITY;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (times[i] < previous_time)
+        {
+            LOG_ERROR("Plot ticks must be appended in non-decreasing time order.");
+            return false;
+        }
+        previous_time = times[i];
+    }
+
+    if (!GooeyPlotPyramid_Append(&candles->pyramid, times, prices, count))
+        return false;
+
+    candles->appended = true;
+    plot->data_generation++;
+    candles->data_generation = plot->data_generation;
+    GooeyWidget_MarkDirty(&plot->core);
+    return true;
+}
@@ -42,6 +42,8 @@ GooeyRadioButton *GooeyRadioButtonGroup_AddChild(GooeyWindow *win, GooeyRadioBut
     GooeyRadioButton *button = &group->buttons[group->button_count++];
     button->core.x = x;
     button->core.y = y;
+    button->core.width = RADIO_BUTTON_RADIUS * 2;
+    button->core.height = RADIO_BUTTON_RADIUS * 2;
 
     button->core.type = WIDGET_RADIOBUTTON;
     button->selected = false;
@@ -50,6 +52,7 @@ GooeyRadioButton *GooeyRadioButtonGroup_AddChild(GooeyWindow *win, GooeyRadioBut
     else
         sprintf(button->label, "Radio button %d", group->button_count);
 
+    GooeyWindow_RegisterWidget(win, (GooeyWidget *)&button->core);
     LOG_INFO("Added child to radio button group at x=%d, y=%d.", x, y);
 
     return button;
@@ -88,6 +91,9 @@ void GooeyRadioButtonGroup_Draw(GooeyWindow *win)
         for (int j = 0; j < group->button_count; ++j)
         {
             GooeyRadioButton *button = &group->buttons[j];
+            if (!GooeyWindow_IsDamaged(win, &button->core))
+                continue;
+
             int button_center_x = button->core.x + RADIO_BUTTON_RADIUS;
             int button_center_y = button->core.y + RADIO_BUTTON_RADIUS;
 
@@ -113,59 +119,87 @@ void GooeyRadioButtonGroup_Draw(GooeyWindow *win)
     }
 }
 
-bool GooeyRadioButtonGroup_HandleClick(GooeyWindow *win, int x, int y)
+/**
+ * @brief Finds the group a radio button belongs to, NULL for a standalone one.
+ */
+static GooeyRadioButtonGroup *find_group(GooeyWindow *win, GooeyRadioButton *button)
 {
-    for (size_t i = 0; i < win->radio_button_group_count; ++i)
+    // Grouped buttons are stored inline in their group, so the address alone tells which group it is.
+    char *first = (char *)win->radio_button_groups;
+    char *last = (char *)(win->radio_button_groups + win->radio_button_group_count);
+    char *address = (char *)button;
+
+    if (address < first || address >= last)
+        return NULL;
+
+    return &win->radio_button_groups[(address - first) / sizeof(GooeyRadioButtonGroup)];
+}
+
+bool GooeyRadioButton_HandleClickOn(GooeyWindow *win, GooeyRadioButton *button, int x, int y)
+{
+    GooeyRadioButtonGroup *group = find_group(win, button);
+
+    if (group)
     {
-        GooeyRadioButtonGroup *group = &win->radio_button_groups[i];
-        for (int j = 0; j < group->button_count; ++j)
+        int dx = x - (button->core.x + RADIO_BUTTON_RADIUS);
+        int dy = y - (button->core.y + RADIO_BUTTON_RADIUS);
+        if (dx * dx + dy * dy > (RADIO_BUTTON_RADIUS + 10) * (RADIO_BUTTON_RADIUS + 10))
+            return false;
+
+        for (int k = 0; k < group->button_count; ++k)
         {
-            GooeyRadioButton *button = &group->buttons[j];
-            int dx = x - (button->core.x + RADIO_BUTTON_RADIUS);
-            int dy = y - (button->core.y + RADIO_BUTTON_RADIUS);
+            if (group->buttons[k].selected)
+                GooeyWidget_MarkDirty(&group->buttons[k].core);
+            group->buttons[k].selected = false;
+        }
 
-            if (dx * dx + dy * dy <= (RADIO_BUTTON_RADIUS + 10) * (RADIO_BUTTON_RADIUS + 10))
-            {
-                for (int k = 0; k < group->button_count; ++k)
-                {
-                    group->buttons[k].selected = false;
-                }
-
-                button->selected = true;
-
-                if (button->callback)
-                {
-                    button->callback(true);
-                }
-                return true;
-            }
+        button->selected = true;
+        GooeyWidget_MarkDirty(&button->core);
+
+        if (button->callback)
+        {
+            button->callback(true);
         }
+        return true;
     }
-    return false;
-}
 
-bool GooeyRadioButton_HandleClick(GooeyWindow *win, int x, int y)
-{
-    int state = false;
+    int dx = x - button->core.x;
+    int dy = y - button->core.y;
+    if (dx * dx + dy * dy > button->radius * button->radius)
+        return false;
+
+    // Standalone radio buttons of a window behave as one implicit group.
     for (size_t i = 0; i < win->radio_button_count; ++i)
     {
-        GooeyRadioButton *radio_button = &win->radio_buttons[i];
-        int dx = x - radio_button->core.x;
-        int dy = y - radio_button->core.y;
-        if (dx * dx + dy * dy <= radio_button->radius * radio_button->radius)
-        {
-            radio_button->selected = !radio_button->selected;
-            if (radio_button->callback)
-                radio_button->callback(radio_button->selected);
-            state = true;
-        }
-        else
+        GooeyRadioButton *other = &win->radio_buttons[i];
+        if (other != button && other->selected)
         {
-            if (radio_button->selected)
-            {
-                radio_button->selected = !radio_button->selected;
-            }
+            other->selected = false;
+            GooeyWidget_MarkDirty(&other->core);
         }
     }
-    return state;
-}
\ No newline at end of file
+
+    button->selected = !button->selected;
+    GooeyWidget_MarkDirty(&button->core);
+    if (button->callback)
+        button->callback(button->selected);
+    return true;
+}
+
+bool GooeyRadioButtonGroup_HandleClick(GooeyWindow *win, int x, int y)
+{
+    GooeyWidget *target = GooeyWindow_WidgetAt(win, x, y);
+    if (!target || target->type != WIDGET_RADIOBUTTON || !find_group(win, (GooeyRadioButton *)target))
+        return false;
+
+    return GooeyRadioButton_HandleClickOn(win, (GooeyRadioButton *)target, x, y);
+}
+
+bool GooeyRadioButton_HandleClick(GooeyWindow *win, int x, int y)
+{
+    GooeyWidget *target = GooeyWindow_WidgetAt(win, x, y);
+    if (!target || target->type != WIDGET_RADIOBUTTON || find_group(win, (GooeyRadioButton *)target))
+        return false;
+
+    return GooeyRadioButton_HandleClickOn(win, (GooeyRadioButton *)target, x, y);
+}
@@ -70,6 +70,7 @@ void GooeySlider_setValue(GooeySlider *slider, long value)
     }
 
     slider->value = value;
+    GooeyWidget_MarkDirty(&slider->core);
 }
 
 void GooeySlider_Draw(GooeyWindow *win)
@@ -77,6 +78,8 @@ void GooeySlider_Draw(GooeyWindow *win)
     for (size_t i = 0; i < win->slider_count; ++i)
     {
         GooeySlider *slider = &win->sliders[i];
+        if (!GooeyWindow_IsDamaged(win, &slider->core))
+            continue;
 
         active_backend->FillRectangle(slider->core.x,
                                       slider->core.y, slider->core.width, slider->core.height, active_theme->widget_base, win->creation_id);
@@ -114,11 +117,33 @@ void GooeySlider_Draw(GooeyWindow *win)
         active_backend->SetForeground(active_theme->neutral);
     }
 }
-bool GooeySlider_HandleDrag(GooeyWindow *win, GooeyEvent *event)
+/** Slider being dragged, if any. */
+static GooeySlider *active_slider = NULL;
+
+static void slider_follow_pointer(GooeySlider *slider, int mouse_x)
+{
+    slider->value =
+        slider->min_value +
+        ((mouse_x - slider->core.x) * (slider->max_value - slider->min_value)) /
+            slider->core.width;
+
+    if (slider->value < slider->min_value)
+        slider->value = slider->min_value;
+    if (slider->value > slider->max_value)
+        slider->value = slider->max_value;
+
+    GooeyWidget_MarkDirty(&slider->core);
+}
+
+bool GooeySlider_HandleClickOn(GooeySlider *slider, int x)
 {
-    static GooeySlider *active_slider = NULL;
-    const int comfort_margin = 20;
+    active_slider = slider;
+    slider_follow_pointer(slider, x);
+    return true;
+}
 
+bool GooeySlider_HandleDrag(GooeyWindow *win, GooeyEvent *event)
+{
     int mouse_x = event->mouse_move.x;
     int mouse_y = event->mouse_move.y;
 
@@ -129,44 +154,25 @@ bool GooeySlider_HandleDrag(GooeyWindow *win, GooeyEvent *event)
         {
             active_slider->callback(active_slider->value);
         }
+        GooeyWidget_MarkDirty(&active_slider->core);
 
         active_slider = NULL;
-        active_backend->InhibitResetEvents(0);
 
         return true;
     }
 
-    for (size_t i = 0; i < win->slider_count; ++i)
+    if (event->type == GOOEY_EVENT_CLICK_PRESS && !active_slider)
     {
-        GooeySlider *slider = &win->sliders[i];
-
-        bool within_bounds =
-            (mouse_y >= slider->core.y - comfort_margin && mouse_y <= slider->core.y + slider->core.height + comfort_margin) &&
-            (mouse_x >= slider->core.x && mouse_x <= slider->core.x + slider->core.width);
-
-        if (within_bounds && event->type == GOOEY_EVENT_CLICK_PRESS)
-        {
-            active_slider = slider;
-        }
+        GooeyWidget *target = GooeyWindow_WidgetAt(win, mouse_x, mouse_y);
+        if (target && target->type == WIDGET_SLIDER)
+            return GooeySlider_HandleClickOn((GooeySlider *)target, mouse_x);
     }
 
     if (active_slider)
     {
-        active_backend->InhibitResetEvents(1);
-        active_slider->value =
-            active_slider->min_value +
-            ((mouse_x - active_slider->core.x) * (active_slider->max_value - active_slider->min_value)) /
-                active_slider->core.width;
-
-        if (active_slider->value < active_slider->min_value)
-            active_slider->value = active_slider->min_value;
-        if (active_slider->value > active_slider->max_value)
-            active_slider->value = active_slider->max_value;
-
+        slider_follow_pointer(active_slider, mouse_x);
         return true;
     }
 
-    active_backend->InhibitResetEvents(0);
-
     return false;
 }
@@ -59,6 +59,7 @@ void GooeyTextbox_setText(GooeyTextbox *textbox, const char *text)
         return;
     }
     strcpy(textbox->text, text);
+    GooeyWidget_MarkDirty(&textbox->core);
 }
 
 void GooeyTextbox_Draw(GooeyWindow *win)
@@ -66,6 +67,9 @@ void GooeyTextbox_Draw(GooeyWindow *win)
 
     for (size_t index = 0; index < win->textboxes_count; ++index)
     {
+        if (!GooeyWindow_IsDamaged(win, &win->textboxes[index].core))
+            continue;
+
         active_backend->FillRectangle(win->textboxes[index].core.x, win->textboxes[index].core.y,
                                       win->textboxes[index].core.width, win->textboxes[index].core.height, active_theme->base, win->creation_id);
 
@@ -107,17 +111,17 @@ void GooeyTextbox_Draw(GooeyWindow *win)
     }
 }
 
-void GooeyTextbox_HandleKeyPress(GooeyWindow *win, GooeyEvent *key_event)
+bool GooeyTextbox_HandleKeyPress(GooeyWindow *win, GooeyEvent *key_event)
 {
 
     static bool is_capslock_on = false;
     static int ascii_offset = 'a' - 'A';
-    printf("Key pressed\n");
+    bool changed = false;
 
     const char *buf = active_backend->GetKeyFromCode(key_event);
     if (buf == NULL)
     {
-        return;
+        return false;
     }
 
     for (size_t i = 0; i < win->textboxes_count; i++)
@@ -126,6 +130,8 @@ void GooeyTextbox_HandleKeyPress(GooeyWindow *win, GooeyEvent *key_event)
             continue;
 
         size_t len = strlen(win->textboxes[i].text);
+        GooeyWidget_MarkDirty(&win->textboxes[i].core);
+        changed = true;
 
         if (strcmp(buf, "Backspace") == 0)
         {
@@ -184,28 +190,30 @@ void GooeyTextbox_HandleKeyPress(GooeyWindow *win, GooeyEvent *key_event)
         }
     }
 
-    //GooeyWindow_Redraw(win);
+    return changed;
 }
 
-bool GooeyTextbox_HandleClick(GooeyWindow *win, int x, int y)
+bool GooeyTextbox_HandleClickOn(GooeyWindow *win, GooeyTextbox *textbox)
 {
-    for (size_t i = 0; i < win->textboxes_count; i++)
+    // Focus the clicked textbox and unfocus others
+    textbox->focused = true;
+    GooeyWidget_MarkDirty(&textbox->core);
+    for (size_t j = 0; j < win->textboxes_count; j++)
     {
-        GooeyTextbox *textbox = &win->textboxes[i];
-        if (x >= textbox->core.x &&
-            x <= textbox->core.x + textbox->core.width &&
-            y >= textbox->core.y &&
-            y <= textbox->core.y + textbox->core.height)
+        if (&win->textboxes[j] != textbox && win->textboxes[j].focused)
         {
-            // Focus the clicked textbox and unfocus others
-            textbox->focused = true;
-            for (size_t j = 0; j < win->textboxes_count; j++)
-            {
-                if (j != i)
-                    win->textboxes[j].focused = false;
-            }
-            return true;
+            win->textboxes[j].focused = false;
+            GooeyWidget_MarkDirty(&win->textboxes[j].core);
         }
     }
-    return false;
+    return true;
+}
+
+bool GooeyTextbox_HandleClick(GooeyWindow *win, int x, int y)
+{
+    GooeyWidget *target = GooeyWindow_WidgetAt(win, x, y);
+    if (!target || target->type != WIDGET_TEXTBOX)
+        return false;
+
+    return GooeyTextbox_HandleClickOn(win, (GooeyTextbox *)target);
 }